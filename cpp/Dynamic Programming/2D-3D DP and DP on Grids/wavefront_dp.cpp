@@ -0,0 +1,263 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+=====================================================
+WAVEFRONT (ANTI-DIAGONAL) PARALLEL 2D DP
+=====================================================
+lcs_tabu, editDistance_tabu, distinct_subseq_tabu,
+WildcardMatching_tabu, minPathsum_tabulation and
+unique_paths_tabulation all share one shape:
+
+    dp[i][j] depends only on dp[i-1][j], dp[i][j-1]
+    and dp[i-1][j-1]
+
+They fill the table row by row on ONE core. But all
+cells on an anti-diagonal (i + j = const) are
+independent of each other, so they could be computed
+at the same time.
+
+INTUITION:
+1️⃣ Cut the table into TILE x TILE blocks. A block
+   needs only the block above, to the left and
+   diagonally up-left → blocks on the same block
+   anti-diagonal ("wave") are independent.
+2️⃣ Waves run one after another; inside a wave the
+   blocks are shared among threads (atomic counter),
+   followed by a barrier before the next wave.
+3️⃣ Inside a block the cells are filled row by row,
+   exactly like the original loops → the block stays
+   in cache, and the recurrence code is unchanged.
+4️⃣ The recurrence plugs in as a lambda cell(i, j)
+   that reads its neighbours from the caller's table
+   and writes dp[i][j]. The executor only guarantees
+   the order: up, left and up-left are always done.
+
+Available parallelism ramps up to min(#row blocks,
+#col blocks) in the middle waves; for a 50k x 50k
+table with 64-wide tiles that is 782 blocks per wave.
+=====================================================
+*/
+
+// Reusable barrier for the worker threads (C++17 has no std::barrier)
+class WaveBarrier
+{
+public:
+    explicit WaveBarrier(int n) : n(n) {}
+
+    void wait()
+    {
+        unique_lock<mutex> lock(m);
+        long long gen = generation;
+        if (++waiting == n) {
+            waiting = 0;
+            generation++;
+            cv.notify_all();
+        } else {
+            cv.wait(lock, [&] { return generation != gen; });
+        }
+    }
+
+private:
+    mutex m;
+    condition_variable cv;
+    int n, waiting = 0;
+    long long generation = 0;
+};
+
+class WavefrontExecutor
+{
+public:
+    WavefrontExecutor(int threads = max(1u, thread::hardware_concurrency()), int tile = 64)
+        : threads(max(1, threads)), tile(max(1, tile)) {}
+
+    // Calls cell(i, j) for every 0 <= i < rows, 0 <= j < cols, each
+    // after (i-1, j), (i, j-1) and (i-1, j-1)
+    template <class Cell>
+    void run(int rows, int cols, Cell cell)
+    {
+        if (rows <= 0 || cols <= 0) return;
+        int TR = (rows + tile - 1) / tile, TC = (cols + tile - 1) / tile;
+        int waves = TR + TC - 1;
+
+        auto doTile = [&](int ti, int tj) {
+            int iEnd = min(rows, (ti + 1) * tile), jEnd = min(cols, (tj + 1) * tile);
+            for (int i = ti * tile; i < iEnd; i++)
+                for (int j = tj * tile; j < jEnd; j++)
+                    cell(i, j);
+        };
+
+        int workers = min(threads, min(TR, TC));
+        if (workers == 1) { // no wave has two blocks → plain blocked loop
+            for (int ti = 0; ti < TR; ti++)
+                for (int tj = 0; tj < TC; tj++)
+                    doTile(ti, tj);
+            return;
+        }
+
+        unique_ptr<atomic<int>[]> next(new atomic<int>[waves]());
+        WaveBarrier barrier(workers);
+        auto worker = [&]() {
+            for (int w = 0; w < waves; w++) {
+                int lo = max(0, w - TC + 1), hi = min(w, TR - 1);
+                for (int k; (k = next[w]++) <= hi - lo;)
+                    doTile(lo + k, w - lo - k);
+                barrier.wait();
+            }
+        };
+
+        vector<thread> pool;
+        for (int t = 1; t < workers; t++) pool.emplace_back(worker);
+        worker(); // the calling thread works too
+        for (auto& th : pool) th.join();
+    }
+
+private:
+    int threads, tile;
+};
+
+/*
+=====================================================
+PLUG-INS: the original recurrences as cell lambdas
+(flat tables; vector<char> instead of vector<bool>,
+because neighbouring bits must not be written from
+two threads)
+=====================================================
+*/
+
+int lcs_wavefront(string &s1, string &s2, WavefrontExecutor ex = WavefrontExecutor())
+{
+    int n = s1.size(), m = s2.size();
+    size_t W = m + 1; // size_t: 50k x 50k cells overflow int
+    vector<int> dp((size_t)(n + 1) * W, 0);
+    ex.run(n + 1, m + 1, [&](int i, int j) {
+        if (i == 0 || j == 0) return;
+        if (s1[i - 1] == s2[j - 1])
+            dp[i * W + j] = 1 + dp[(i - 1) * W + j - 1];
+        else
+            dp[i * W + j] = max(dp[(i - 1) * W + j], dp[i * W + j - 1]);
+    });
+    return dp[n * W + m];
+}
+
+int editDistance_wavefront(string &str1, string &str2, WavefrontExecutor ex = WavefrontExecutor())
+{
+    int n = str1.size(), m = str2.size();
+    size_t W = m + 1;
+    vector<int> dp((size_t)(n + 1) * W, 0);
+    ex.run(n + 1, m + 1, [&](int i, int j) {
+        if (i == 0 || j == 0)
+            dp[i * W + j] = i + j;
+        else if (str1[i - 1] == str2[j - 1])
+            dp[i * W + j] = dp[(i - 1) * W + j - 1];
+        else
+            dp[i * W + j] = 1 + min({dp[(i - 1) * W + j],        // delete
+                                     dp[(i - 1) * W + j - 1],    // replace
+                                     dp[i * W + j - 1]});        // insert
+    });
+    return dp[n * W + m];
+}
+
+long long distinct_subseq_wavefront(string &s, string &t, WavefrontExecutor ex = WavefrontExecutor())
+{
+    int n = s.size(), m = t.size();
+    size_t W = m + 1;
+    vector<long long> dp((size_t)(n + 1) * W, 0);
+    ex.run(n + 1, m + 1, [&](int i, int j) {
+        if (j == 0)
+            dp[i * W] = 1; // empty T ⇒ 1 subsequence always
+        else if (i == 0)
+            dp[j] = 0;
+        else if (s[i - 1] == t[j - 1])
+            dp[i * W + j] = dp[(i - 1) * W + j - 1] + dp[(i - 1) * W + j];
+        else
+            dp[i * W + j] = dp[(i - 1) * W + j];
+    });
+    return dp[n * W + m];
+}
+
+bool WildcardMatching_wavefront(string &pattern, string &text, WavefrontExecutor ex = WavefrontExecutor())
+{
+    int n = pattern.size(), m = text.size();
+    size_t W = m + 1;
+    vector<char> dp((size_t)(n + 1) * W, 0);
+    ex.run(n + 1, m + 1, [&](int i, int j) {
+        char &cur = dp[i * W + j];
+        if (i == 0)
+            cur = j == 0; // empty pattern matches only empty text
+        else if (j == 0)
+            cur = pattern[i - 1] == '*' && dp[(i - 1) * W]; // only '*' so far
+        else if (pattern[i - 1] == text[j - 1] || pattern[i - 1] == '?')
+            cur = dp[(i - 1) * W + j - 1];
+        else if (pattern[i - 1] == '*')
+            cur = dp[(i - 1) * W + j] || dp[i * W + j - 1];
+        else
+            cur = false;
+    });
+    return dp[n * W + m];
+}
+
+int minPathsum_wavefront(vector<vector<int>> &grid, WavefrontExecutor ex = WavefrontExecutor())
+{
+    int n = grid.size(), m = grid[0].size();
+    size_t W = m;
+    vector<int> dp(n * W, 0);
+    ex.run(n, m, [&](int i, int j) {
+        if (i == 0 && j == 0) {
+            dp[0] = grid[0][0];
+            return;
+        }
+        int up = grid[i][j] + (i > 0 ? dp[(i - 1) * W + j] : (int)1e9);
+        int left = grid[i][j] + (j > 0 ? dp[i * W + j - 1] : (int)1e9);
+        dp[i * W + j] = min(up, left);
+    });
+    return dp[n * W - 1];
+}
+
+int unique_paths_wavefront(int m, int n, WavefrontExecutor ex = WavefrontExecutor())
+{
+    size_t W = n;
+    vector<int> dp(m * W, 0);
+    ex.run(m, n, [&](int i, int j) {
+        if (i == 0 && j == 0) dp[0] = 1;
+        else {
+            int up = (i > 0) ? dp[(i - 1) * W + j] : 0;
+            int left = (j > 0) ? dp[i * W + j - 1] : 0;
+            dp[i * W + j] = up + left;
+        }
+    });
+    return dp[m * W - 1];
+}
+
+int main()
+{
+    string s1 = "abcde", s2 = "ace";
+    cout << "LCS:                 " << lcs_wavefront(s1, s2) << endl;
+
+    string h = "horse", r = "ros";
+    cout << "Edit distance:       " << editDistance_wavefront(h, r) << endl;
+
+    string s = "babgbag", t = "bag";
+    cout << "Distinct subseq:     " << distinct_subseq_wavefront(s, t) << endl;
+
+    string pattern = "ab*cd", text = "abdefcd";
+    cout << "Wildcard match:      " << WildcardMatching_wavefront(pattern, text) << endl;
+
+    vector<vector<int>> grid = {{5, 9, 6}, {11, 5, 2}};
+    cout << "Min path sum:        " << minPathsum_wavefront(grid) << endl;
+    cout << "Unique paths (3x7):  " << unique_paths_wavefront(3, 7) << endl;
+
+    // bigger table, small tiles → many blocks per wave
+    string a(3000, 'a'), b(2500, 'b');
+    for (int i = 0; i < 3000; i += 3) a[i] = 'b';
+    cout << "LCS 3000 x 2500:     " << lcs_wavefront(a, b, WavefrontExecutor(4, 32)) << endl;
+    return 0;
+}
+
+/*
+| Executor                 | Time                         | Extra space        |
+| ------------------------ | ---------------------------- | ------------------ |
+| row-by-row (original)    | O(n * m), 1 core             | -                  |
+| wavefront, T threads     | O(n * m / T + waves * sync)  | O(waves) counters  |
+waves = n/TILE + m/TILE - 1; the table itself is the caller's (as before).
+*/
@@ -0,0 +1,292 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*-----------------------------------------------------------
+    🔹 INTUITION — ONE SUBSET-SUM ENGINE FOR THE WHOLE FAMILY
+    subsetSumToK_tabu, canPartition, miSubsetSumDifference,
+    countPartitions and findTargetSumWays all ask about the
+    same set:  which sums t ≤ K can a subset make?
+
+    1️⃣ Reachability as bits
+        bit t = "sum t can be made". Taking item w means
+            bits |= bits << w
+        → one item = K/64 word operations instead of K bools.
+        canPartition_Bitset does this with bitset<20200>; here
+        the width is chosen at runtime (no cap, no waste).
+
+    2️⃣ Shift-or in place
+        Walking the words from high to low, word i only reads
+        words ≤ i that are not updated yet → no temporary copy.
+        Only words up to the largest sum reached so far are
+        touched. The loop is plain 64-bit words: with -O3
+        (-mavx2) the compiler vectorises it.
+
+    3️⃣ Repeated weights (√ trick)
+        If weight w occurs c ≥ 3 times, keep 1 or 2 copies and
+        turn every further PAIR into one item of weight 2w:
+        the reachable sums do not change. Afterwards each
+        weight occurs at most twice, and distinct weights with
+        total S number at most √(2S) → O(S √S / 64) overall.
+
+    4️⃣ Counting (mod p)
+        - countSubsets: subsets of POSITIONS (noofsubset_so,
+          countPartitions, target sum). Equal items are still
+          different choices, so each item is one 1D pass.
+        - countMultisets: different multisets of VALUES.
+          All c copies of w at once:
+            new[s] = old[s] + old[s-w] + ... + old[s-c*w]
+          a sliding window along s ≡ r (mod w) → O(K) per
+          distinct weight, O(K √S) overall.
+-----------------------------------------------------------*/
+
+
+/********************** RUNTIME-WIDTH BITSET **********************/
+
+class DynamicBitset
+{
+public:
+    explicit DynamicBitset(size_t bits) : n(bits), w((bits + 63) / 64, 0) {}
+
+    size_t size() const { return n; }
+    void set(size_t i) { w[i / 64] |= 1ULL << (i % 64); }
+    bool test(size_t i) const { return i < n && (w[i / 64] >> (i % 64) & 1); }
+
+    // *this |= *this << k, only bits [0, highBit] can be set afterwards
+    void orShiftLeft(size_t k, size_t highBit)
+    {
+        if (k == 0 || k >= n)
+            return;
+        size_t q = k / 64, r = k % 64;
+        size_t top = min(w.size() - 1, min(highBit, n - 1) / 64);
+        if (r == 0)
+        {
+            for (size_t i = top; i >= q; i--) // k > 0 → q ≥ 1, no wrap-around
+                w[i] |= w[i - q];
+        }
+        else
+        {
+            for (size_t i = top; i > q; i--)
+                w[i] |= (w[i - q] << r) | (w[i - q - 1] >> (64 - r));
+            if (top >= q)
+                w[q] |= w[0] << r;
+        }
+        if (n % 64)
+            w.back() &= (1ULL << (n % 64)) - 1; // drop sums beyond the width
+    }
+
+    // largest set bit ≤ i, or -1
+    long long prevSet(size_t i) const
+    {
+        i = min(i, n - 1);
+        size_t k = i / 64;
+        uint64_t word = w[k] & (i % 64 == 63 ? ~0ULL : (2ULL << (i % 64)) - 1);
+        while (true)
+        {
+            if (word)
+                return k * 64 + 63 - __builtin_clzll(word);
+            if (k == 0)
+                return -1;
+            word = w[--k];
+        }
+    }
+
+private:
+    size_t n;
+    vector<uint64_t> w;
+};
+
+
+/************************ SUBSET-SUM ENGINE ***********************/
+
+class SubsetSumEngine
+{
+public:
+    // only sums 0..limit are tracked
+    SubsetSumEngine(const vector<int> &arr, int limit) : limit(max(limit, 0))
+    {
+        for (int x : arr)
+            if (x == 0)
+                zeros++;
+            else if (x <= this->limit)
+                count[x]++;
+    }
+
+    /*-------------------- reachability --------------------*/
+    const DynamicBitset &reachable()
+    {
+        if (bits)
+            return *bits;
+        bits = make_unique<DynamicBitset>((size_t)limit + 1);
+        bits->set(0);
+
+        // √ trick: at most 2 copies per weight, pairs move to 2w
+        map<int, long long> c(count.begin(), count.end());
+        long long reach = 0;
+        for (auto it = c.begin(); it != c.end(); ++it)
+        {
+            long long w = it->first, k = it->second;
+            if (k >= 3)
+            {
+                long long pairs = (k - 1) / 2;
+                k -= 2 * pairs;
+                if (2 * w <= limit)
+                    c[2 * w] += pairs; // 2w > w → visited later
+            }
+            for (int rep = 0; rep < k; rep++)
+            {
+                reach = min<long long>(reach + w, limit);
+                bits->orShiftLeft(w, reach);
+            }
+        }
+        return *bits;
+    }
+
+    bool canMake(int t) { return t >= 0 && t <= limit && reachable().test(t); }
+
+    // largest reachable sum ≤ t (0 is always reachable)
+    int closestBelow(int t) { return t < 0 ? -1 : reachable().prevSet(min(t, limit)); }
+
+    /*-------------------- counting mod p --------------------*/
+    // number of index subsets with sum t (zeros double the count)
+    long long countSubsets(int t, long long mod)
+    {
+        if (t < 0 || t > limit)
+            return 0;
+        vector<long long> dp(t + 1, 0);
+        dp[0] = 1 % mod;
+        int reach = 0;
+        for (auto [w, k] : count)
+        {
+            if (w > t)
+                break;
+            for (int rep = 0; rep < k; rep++)
+            {
+                reach = min(reach + w, t);
+                for (int s = reach; s >= w; s--) // 1D knapsack, backwards
+                    dp[s] = (dp[s] + dp[s - w]) % mod;
+            }
+        }
+        long long ans = dp[t];
+        for (int z = 0; z < zeros; z++)
+            ans = ans * 2 % mod;
+        return ans;
+    }
+
+    // number of different multisets of values with sum t
+    long long countMultisets(int t, long long mod)
+    {
+        if (t < 0 || t > limit)
+            return 0;
+        vector<long long> dp(t + 1, 0), old;
+        dp[0] = 1 % mod;
+        for (auto [w, k] : count)
+        {
+            if (w > t)
+                break;
+            old = dp;
+            long long span = (long long)(k + 1) * w; // window = k + 1 terms
+            for (int s = w; s <= t; s++)
+            {
+                dp[s] = (dp[s - w] + old[s]) % mod;
+                if (s >= span)
+                    dp[s] = (dp[s] - old[s - span] + mod) % mod;
+            }
+        }
+        return dp[t] * ((zeros + 1) % mod) % mod;
+    }
+
+private:
+    int limit, zeros = 0;
+    map<int, int> count; // weight → multiplicity (zeros apart)
+    unique_ptr<DynamicBitset> bits;
+};
+
+
+/*************** SAME SIGNATURES AS THE TABLE VERSIONS ***************/
+
+const int MOD = 1e9 + 7;
+
+bool subsetSumToK_bits(int n, int k, vector<int> &arr)
+{
+    vector<int> items(arr.begin(), arr.begin() + n);
+    return SubsetSumEngine(items, k).canMake(k);
+}
+
+bool canPartition_dynamic(vector<int> &nums)
+{
+    long long sum = accumulate(nums.begin(), nums.end(), 0LL);
+    if (sum & 1)
+        return false;
+    return SubsetSumEngine(nums, sum / 2).canMake(sum / 2);
+}
+
+int miSubsetSumDifference_bits(vector<int> &arr, int n)
+{
+    vector<int> items(arr.begin(), arr.begin() + n);
+    long long total = accumulate(items.begin(), items.end(), 0LL);
+    long long s1 = SubsetSumEngine(items, total / 2).closestBelow(total / 2);
+    return total - 2 * s1;
+}
+
+int countPartitions_bits(int n, int d, vector<int> &arr)
+{
+    vector<int> items(arr.begin(), arr.begin() + n);
+    long long total = accumulate(items.begin(), items.end(), 0LL);
+    if (total - d < 0 || (total - d) % 2 != 0)
+        return 0;
+    int target = (total - d) / 2;
+    return SubsetSumEngine(items, target).countSubsets(target, MOD);
+}
+
+int findTargetSumWays_bits(vector<int> &nums, int target)
+{
+    long long total = accumulate(nums.begin(), nums.end(), 0LL);
+    if ((total + target) % 2 != 0 || total < abs(target))
+        return 0;
+    int sum = (total + target) / 2;
+    return SubsetSumEngine(nums, sum).countSubsets(sum, MOD);
+}
+
+
+/***************************** MAIN *******************************/
+
+int main()
+{
+    vector<int> arr = {2, 3, 1, 1};
+    cout << "Subset sum to 4 exists: " << subsetSumToK_bits(arr.size(), 4, arr) << "\n";
+
+    vector<int> nums = {1, 5, 11, 5};
+    cout << "Can partition {1,5,11,5}: " << (canPartition_dynamic(nums) ? "YES" : "NO") << "\n";
+
+    vector<int> v = {3, 1, 6, 2, 2};
+    cout << "Min subset sum difference: " << miSubsetSumDifference_bits(v, v.size()) << "\n";
+
+    vector<int> p = {5, 2, 6, 4};
+    cout << "Partitions with difference 3: " << countPartitions_bits(p.size(), 3, p) << "\n";
+
+    vector<int> ts = {1, 1, 1, 1, 1};
+    cout << "Target sum ways (+/- to reach 3): " << findTargetSumWays_bits(ts, 3) << "\n";
+
+    vector<int> coins = {1, 1, 2, 2, 2, 5};
+    SubsetSumEngine eng(coins, 20);
+    cout << "Ways to pick coins for 5 (positions / value multisets): "
+         << eng.countSubsets(5, MOD) << " / " << eng.countMultisets(5, MOD) << "\n";
+
+    // far beyond bitset<20200>: 200000 items, sums up to 10^8
+    vector<int> big(200000);
+    for (int i = 0; i < (int)big.size(); i++)
+        big[i] = 1 + (i * 7919LL) % 1000;
+    cout << "Big partition (200000 items): " << (canPartition_dynamic(big) ? "YES" : "NO") << "\n";
+    return 0;
+}
+
+/*
+| Operation                  | Time                         | Space        |
+| -------------------------- | ---------------------------- | ------------ |
+| subsetSumToK_tabu (table)  | O(n * K)                     | O(n * K)     |
+| reachable (shift-or)       | O(n * K / 64)                | O(K / 64)    |
+| reachable + √ trick        | O(min(n, √S) * K / 64)       | O(K / 64)    |
+| countSubsets (mod p)       | O(n * K)                     | O(K)         |
+| countMultisets (mod p)     | O(#distinct weights * K)     | O(K)         |
+K = largest sum asked for, S = total of the items.
+*/
@@ -0,0 +1,474 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+    Knapsack engine:
+    knapsack_tabu / knapsack_moreSo, unbounded_knapsack_moreso and
+    rod_cut_moreSO all fill an O(N * W) table. With W in the
+    billions that table cannot even be allocated, so the engine
+    picks a method by the SHAPE of the instance:
+
+    1) 1D DP            W and N * W small enough
+       - the usual backward loop, branch-free so it vectorises
+       - one "taken" BIT per (item, capacity) → the chosen items
+         are read back like in printLcs (64x less than int tables)
+    2) Meet in the middle   N <= 40, any W
+       (first choice for few items: 2^(N/2) beats N * W quickly)
+       - all subsets of each half, built sorted by weight by
+         merging (no sort); dominated subsets (heavier but not
+         more valuable) are dropped on the way
+       - one sweep pairs every left subset with its best partner
+    3) Reduction + branch and bound   large N, huge W
+       - sort by value/weight; the greedy fill is the first answer
+       - LP bound (fractional knapsack) around the break item fixes
+         every item whose flip provably cannot beat the answer;
+         the items left form a small CORE (as in Pisinger's work)
+       - the core is solved by a DP over Pareto states (weight,
+         value), dropping states whose LP bound cannot win
+         (prefix sums → O(log N) per bound)
+
+    Unbounded knapsack / rod cutting: the best value/weight item
+    fills everything beyond w_best * w_max, so the 1D DP only runs
+    up to that bound; if even that is too big, every item becomes
+    0/1 copies of 1, 2, 4, ... units and goes through the engine.
+*/
+
+enum class KnapsackMethod { DP, MeetInMiddle, BranchAndBound };
+
+struct KnapsackResult {
+    long long value = 0, weight = 0;
+    vector<int> items;          // chosen item indices, ascending
+    KnapsackMethod method = KnapsackMethod::DP;
+    bool optimal = true;        // false only if the core search hit its state limit
+};
+
+class KnapsackSolver {
+public:
+    static const long long DP_CELLS = 1LL << 28;   // ~32 MB of "taken" bits
+    static const long long DP_WIDTH = 1LL << 22;   // ~32 MB for the best[0..W] row
+    static const int MITM_ITEMS = 40;
+
+    // the DP needs best[0..W] AND N * (W + 1) taken bits
+    static bool dpFits(long long items, long long capacity) {
+        return capacity < DP_WIDTH && items * (capacity + 1) <= DP_CELLS;
+    }
+
+    KnapsackSolver(const vector<long long>& weight, const vector<long long>& value)
+        : wt(weight), val(value) {}
+
+    KnapsackResult solve(long long capacity) {
+        vector<int> ids = usefulItems(capacity);
+        long long n = ids.size();
+        // few items: MITM unless the DP fits and 2^(N/2) is more work than N * W
+        if (n <= MITM_ITEMS && (!dpFits(n, capacity) || (1LL << (n + 1) / 2) <= n * (capacity + 1)))
+            return finish(ids, capacity, KnapsackMethod::MeetInMiddle);
+        if (dpFits(n, capacity)) return finish(ids, capacity, KnapsackMethod::DP);
+        return finish(ids, capacity, KnapsackMethod::BranchAndBound);
+    }
+
+    // force one method (tests, benchmarks); a method that does not fit
+    // the instance (DP table too big, > 40 items for MITM) falls back to B&B
+    KnapsackResult solveWith(KnapsackMethod method, long long capacity) {
+        return finish(usefulItems(capacity), capacity, method);
+    }
+
+    long long stateLimit = 10'000'000;  // core search budget (~24 bytes per state)
+
+private:
+    vector<long long> wt, val;
+
+    // items that can matter: positive value, fits on its own
+    vector<int> usefulItems(long long capacity) const {
+        vector<int> ids;
+        for (int i = 0; i < (int)wt.size(); i++)
+            if (val[i] > 0 && wt[i] <= capacity) ids.push_back(i);
+        return ids;
+    }
+
+    KnapsackResult finish(vector<int> ids, long long capacity, KnapsackMethod method) {
+        KnapsackResult res;
+        res.method = method;
+        if (capacity < 0) return res;
+
+        // weight-0 items are always taken
+        vector<int> rest;
+        for (int i : ids) {
+            if (wt[i] == 0) res.items.push_back(i);
+            else rest.push_back(i);
+        }
+
+        if ((method == KnapsackMethod::DP && !dpFits(rest.size(), capacity)) ||
+            (method == KnapsackMethod::MeetInMiddle && (int)rest.size() > MITM_ITEMS))
+            res.method = method = KnapsackMethod::BranchAndBound;
+
+        vector<int> chosen;
+        if (rest.empty()) chosen = {};  // nothing to decide, whatever W is
+        else if (method == KnapsackMethod::DP) chosen = dp(rest, capacity);
+        else if (method == KnapsackMethod::MeetInMiddle) chosen = meetInMiddle(rest, capacity);
+        else chosen = branchAndBound(rest, capacity, res.optimal);
+
+        res.items.insert(res.items.end(), chosen.begin(), chosen.end());
+        sort(res.items.begin(), res.items.end());
+        for (int i : res.items) res.value += val[i], res.weight += wt[i];
+        return res;
+    }
+
+    //////////////////////////////////////////////////////////
+    // 1) 1D DP + taken bits
+    // Time: O(N * W)    Space: O(W) values + N * W bits
+    //////////////////////////////////////////////////////////
+    vector<int> dp(const vector<int>& ids, long long capacity) {
+        int n = ids.size();
+        size_t C = capacity, words = C / 64 + 1;
+        vector<long long> best(C + 1, 0);
+        vector<uint64_t> taken(n * words, 0);
+
+        for (int k = 0; k < n; k++) {
+            size_t w = wt[ids[k]];
+            long long v = val[ids[k]];
+            uint64_t* row = &taken[k * words];
+            // BACKWARD loop: best[c - w] is still the previous row
+            for (size_t c = C; c >= w; c--) {  // w >= 1: no wrap-around
+                long long cand = best[c - w] + v;
+                bool take = cand > best[c];
+                best[c] = take ? cand : best[c];
+                row[c / 64] |= (uint64_t)take << (c % 64);
+            }
+        }
+
+        vector<int> chosen;
+        size_t c = C;
+        for (int k = n - 1; k >= 0; k--)
+            if (taken[k * words + c / 64] >> (c % 64) & 1) {
+                chosen.push_back(ids[k]);
+                c -= wt[ids[k]];
+            }
+        return chosen;
+    }
+
+    //////////////////////////////////////////////////////////
+    // 2) MEET IN THE MIDDLE
+    // Time: O(2^(N/2))    Space: O(2^(N/2))
+    //////////////////////////////////////////////////////////
+    struct Subset {
+        long long w, v;
+        int mask;  // bit b = b-th item of the half
+    };
+
+    // useful subsets of ids, weight ↑ and value ↑ (Pareto front):
+    // adding item b merges the list with itself shifted by w_b → no sort.
+    // A dominated subset (heavier, not more valuable) stays dominated
+    // whatever is added later, so it is dropped right away.
+    vector<Subset> frontier(const vector<int>& ids, long long capacity) {
+        vector<Subset> cur = {{0, 0, 0}}, shifted, merged;
+        for (int b = 0; b < (int)ids.size(); b++) {
+            shifted.clear();
+            for (const Subset& s : cur)
+                if (s.w + wt[ids[b]] <= capacity) shifted.push_back({s.w + wt[ids[b]], s.v + val[ids[b]], s.mask | 1 << b});
+            merged.resize(cur.size() + shifted.size());
+            merge(cur.begin(), cur.end(), shifted.begin(), shifted.end(), merged.begin(),
+                  [](const Subset& x, const Subset& y) { return x.w != y.w ? x.w < y.w : x.v > y.v; });
+            cur.clear();
+            for (const Subset& s : merged)
+                if (cur.empty() || s.v > cur.back().v) cur.push_back(s);
+        }
+        return cur;
+    }
+
+    vector<int> meetInMiddle(const vector<int>& ids, long long capacity) {
+        int h = ids.size() / 2;
+        vector<int> L(ids.begin(), ids.begin() + h), R(ids.begin() + h, ids.end());
+        vector<Subset> left = frontier(L, capacity), right = frontier(R, capacity);
+
+        // left by weight ↑, its best partner (heaviest that fits) moves ↓
+        long long bestV = -1;
+        int bestL = 0, bestR = 0, k = right.size() - 1;
+        for (const Subset& s : left) {
+            while (k > 0 && s.w + right[k].w > capacity) k--;  // right[0] is the empty subset
+            if (s.v + right[k].v > bestV) bestV = s.v + right[k].v, bestL = s.mask, bestR = right[k].mask;
+        }
+
+        vector<int> chosen;
+        for (int b = 0; b < (int)L.size(); b++) if (bestL >> b & 1) chosen.push_back(L[b]);
+        for (int b = 0; b < (int)R.size(); b++) if (bestR >> b & 1) chosen.push_back(R[b]);
+        return chosen;
+    }
+
+    //////////////////////////////////////////////////////////
+    // 3) REDUCTION + BRANCH AND BOUND
+    // Time: O(N log N) + core DP (bounded by stateLimit)
+    // Space: O(N + core states)
+    //////////////////////////////////////////////////////////
+    vector<int> branchAndBound(vector<int> ids, long long capacity, bool& optimal) {
+        // by efficiency value/weight, best first (exact cross-multiplication)
+        sort(ids.begin(), ids.end(), [&](int a, int b) {
+            return (__int128)val[a] * wt[b] > (__int128)val[b] * wt[a];
+        });
+        int n = ids.size();
+        if (n == 0) return {};
+
+        // break item: first one the greedy prefix cannot take
+        int brk = 0;
+        long long prefW = 0, prefV = 0;
+        while (brk < n && prefW + wt[ids[brk]] <= capacity)
+            prefW += wt[ids[brk]], prefV += val[ids[brk]], brk++;
+        if (brk == n) return ids;  // everything fits
+
+        // greedy answer: the prefix, then any later item that still fits
+        long long best = prefV, room = capacity - prefW;
+        for (int k = brk; k < n; k++)
+            if (wt[ids[k]] <= room) best += val[ids[k]], room -= wt[ids[k]];
+
+        // reduction: LP bound with item k flipped (Dembo-Hammer), in
+        // units of 1/wb:  U * wb = (prefV ± vk) * wb + (r ∓ wk) * vb
+        long long wb = wt[ids[brk]], vb = val[ids[brk]], r = capacity - prefW;
+        vector<int> fixedIn, core;
+        for (int k = 0; k < n; k++) {
+            long long w = wt[ids[k]], v = val[ids[k]];
+            __int128 U = k < brk ? (__int128)(prefV - v) * wb + (__int128)(r + w) * vb
+                                 : (__int128)(prefV + v) * wb + (__int128)(r - w) * vb;
+            bool cannotFlip = U < (__int128)(best + 1) * wb;
+            if (cannotFlip && k < brk) fixedIn.push_back(ids[k]);
+            else if (!cannotFlip) core.push_back(ids[k]);
+            // cannotFlip && k >= brk: fixed out
+        }
+
+        long long cap = capacity, base = 0;
+        for (int i : fixedIn) cap -= wt[i], base += val[i];
+        vector<int> coreBest = searchCore(core, cap, best - base, optimal);
+
+        if (coreBest.empty() && best > base) {
+            // the reduced search found nothing better than greedy → rebuild greedy
+            vector<int> chosen;
+            long long left = capacity;
+            for (int i : ids)
+                if (wt[i] <= left) chosen.push_back(i), left -= wt[i];
+            return chosen;
+        }
+        fixedIn.insert(fixedIn.end(), coreBest.begin(), coreBest.end());
+        return fixedIn;
+    }
+
+    // Pareto DP over the core items (sorted by efficiency), as in Pisinger's
+    // minknap: a state is (weight, value) of a subset of the items so far;
+    // a heavier state must be more valuable, and a state whose LP bound
+    // cannot beat the best value seen is dropped.
+    // Returns a subset worth MORE than `incumbent`, or {} if none exists.
+    vector<int> searchCore(const vector<int>& core, long long capacity, long long incumbent, bool& optimal) {
+        int m = core.size();
+        vector<long long> PW(m + 1, 0), PV(m + 1, 0);
+        for (int k = 0; k < m; k++) PW[k + 1] = PW[k] + wt[core[k]], PV[k + 1] = PV[k] + val[core[k]];
+
+        // LP bound of items k.. with `cap` room, plus `have`
+        auto bound = [&](int k, long long cap, long long have) -> long long {
+            int j = upper_bound(PW.begin() + k, PW.end(), PW[k] + cap) - PW.begin() - 1;
+            long long ub = have + PV[j] - PV[k];
+            if (j < m) ub += (__int128)(cap - (PW[j] - PW[k])) * val[core[j]] / wt[core[j]];
+            return ub;
+        };
+
+        struct State {
+            long long w, v;
+            int prev, item;  // the state it came from, the item added (-1: none)
+        };
+        vector<State> states = {{0, 0, -1, -1}};   // every state ever kept (for read-back)
+        vector<int> cur = {0}, next;               // alive: weight ↑, value ↑
+        long long best = incumbent;
+        int bestState = -1;
+
+        for (int k = 0; k < m && !cur.empty(); k++) {
+            long long w = wt[core[k]], v = val[core[k]];
+            next.clear();
+            // merge "skip k" (cur) and "take k" (cur + item), both by weight
+            size_t a = 0, b = 0;
+            while (a < cur.size() || b < cur.size()) {
+                const State* sa = a < cur.size() ? &states[cur[a]] : nullptr;
+                const State* sb = b < cur.size() ? &states[cur[b]] : nullptr;
+                if (sb && sb->w + w > capacity) sb = nullptr, b = cur.size();  // heavier ones neither
+                if (!sa && !sb) break;
+
+                bool take = sb && (!sa || sb->w + w < sa->w);
+                State cand = take ? State{sb->w + w, sb->v + v, cur[b], core[k]} : *sa;
+                int id = take ? -1 : cur[a];
+                take ? b++ : a++;
+
+                if (!next.empty() && states[next.back()].v >= cand.v) continue;  // dominated
+                bool improves = cand.v > best;
+                if (improves) best = cand.v;
+                bool alive = bound(k + 1, capacity - cand.w, cand.v) > best;
+                if (!improves && !alive) continue;
+                if (id < 0) id = states.size(), states.push_back(cand);
+                if (improves) bestState = id;
+                if (!alive) continue;  // its bound cannot beat best any more
+                while (!next.empty() && states[next.back()].w == cand.w) next.pop_back();
+                next.push_back(id);
+            }
+            swap(cur, next);
+            if ((long long)states.size() > stateLimit) {
+                optimal = false;
+                break;
+            }
+        }
+
+        vector<int> chosen;
+        for (int s = bestState; s >= 0 && states[s].item >= 0; s = states[s].prev)
+            chosen.push_back(states[s].item);
+        return chosen;
+    }
+};
+
+//////////////////////////////////////////////////////////
+// UNBOUNDED KNAPSACK (any item any number of times, weights >= 1)
+// returns count[i] = copies of item i; optimal = false only if the
+// 0/1 fallback below hit the core search's state limit
+//
+// Let b be the item with the best value/weight. Among any w_b other
+// items two prefix sums agree mod w_b, so some of them weigh t * w_b
+// and t copies of b are worth at least as much → an optimal answer
+// uses < w_b other items, weighing < w_b * w_max. Only capacities up
+// to that bound need the DP; the rest is filled with b. That is what
+// makes W in the billions cheap when the weights themselves are small.
+//////////////////////////////////////////////////////////
+vector<long long> unboundedKnapsack(const vector<long long>& weight, const vector<long long>& value,
+                                    long long capacity, long long& total, bool& optimal) {
+    int n = weight.size();
+    vector<long long> count(n, 0);
+    total = 0;
+    optimal = true;
+
+    int b = -1;
+    long long wMax = 0;
+    for (int i = 0; i < n; i++) {
+        if (weight[i] <= 0 || value[i] <= 0 || weight[i] > capacity) continue;
+        wMax = max(wMax, weight[i]);
+        if (b < 0 || (__int128)value[i] * weight[b] > (__int128)value[b] * weight[i]) b = i;
+    }
+    if (b < 0) return count;
+
+    int others = 0;
+    for (int i = 0; i < n; i++)
+        others += i != b && weight[i] > 0 && value[i] > 0 && weight[i] <= capacity;
+    if (others == 0) {  // only b fits: no DP at all
+        count[b] = capacity / weight[b];
+        total = count[b] * value[b];
+        return count;
+    }
+
+    long long B = min<__int128>(capacity, (__int128)(weight[b] - 1) * wMax);
+    if (KnapsackSolver::dpFits(n, B)) {
+        // forward loop = item may be reused; last[c] = item added last
+        vector<long long> best(B + 1, 0);
+        vector<int> last(B + 1, -1);
+        for (int i = 0; i < n; i++) {
+            if (i == b || weight[i] <= 0 || value[i] <= 0) continue;
+            for (long long c = weight[i]; c <= B; c++)
+                if (best[c - weight[i]] + value[i] > best[c]) {
+                    best[c] = best[c - weight[i]] + value[i];
+                    last[c] = i;
+                }
+        }
+        // others weigh c, the rest of the room goes to copies of b
+        long long bestC = 0;
+        auto worth = [&](long long c) { return best[c] + (capacity - c) / weight[b] * value[b]; };
+        for (long long c = 1; c <= B; c++)
+            if (worth(c) > worth(bestC)) bestC = c;
+        total = worth(bestC);
+        count[b] = (capacity - bestC) / weight[b];
+        for (long long c = bestC; c > 0 && last[c] >= 0; c -= weight[last[c]])
+            count[last[c]]++;
+        return count;
+    }
+
+    // huge weights too: copies of 1, 2, 4, ... units become 0/1 items
+    vector<long long> w, v;
+    vector<int> from, units;
+    for (int i = 0; i < n; i++) {
+        if (weight[i] <= 0 || value[i] <= 0) continue;
+        long long left = capacity / weight[i];
+        for (long long u = 1; left > 0; u *= 2) {
+            long long take = min(u, left);
+            w.push_back(take * weight[i]), v.push_back(take * value[i]);
+            from.push_back(i), units.push_back(take);
+            left -= take;
+        }
+    }
+    KnapsackResult r = KnapsackSolver(w, v).solve(capacity);
+    for (int k : r.items) count[from[k]] += units[k];
+    total = r.value;
+    optimal = r.optimal;
+    return count;
+}
+
+//////////////////////////////////////////////////////////
+// Same signatures as the table versions
+//////////////////////////////////////////////////////////
+int knapsack_engine(vector<int>& weight, vector<int>& value, int maxWeight) {
+    vector<long long> w(weight.begin(), weight.end()), v(value.begin(), value.end());
+    return KnapsackSolver(w, v).solve(maxWeight).value;
+}
+
+int unbounded_knapsack_engine(int n, int W, vector<int>& val, vector<int>& wt) {
+    vector<long long> w(wt.begin(), wt.begin() + n), v(val.begin(), val.begin() + n);
+    long long total;
+    bool optimal;
+    unboundedKnapsack(w, v, W, total, optimal);
+    return total;
+}
+
+int rod_cut_engine(int N, vector<int>& price) {
+    vector<long long> len(N), p(price.begin(), price.begin() + N);
+    iota(len.begin(), len.end(), 1);
+    long long total;
+    bool optimal;
+    unboundedKnapsack(len, p, N, total, optimal);
+    return total;
+}
+
+static const char* methodName(KnapsackMethod m) {
+    return m == KnapsackMethod::DP ? "1D DP" : m == KnapsackMethod::MeetInMiddle ? "meet in the middle" : "branch and bound";
+}
+
+//////////////////////////////////////////////////////////
+// MAIN
+//////////////////////////////////////////////////////////
+int main() {
+    vector<int> weight = {1, 3, 4, 5};
+    vector<int> value = {1, 4, 5, 7};
+    cout << "0/1 knapsack (W = 7): " << knapsack_engine(weight, value, 7) << endl;
+
+    vector<int> wt = {2, 4, 6}, val = {5, 11, 13};
+    cout << "Unbounded (W = 10):   " << unbounded_knapsack_engine(3, 10, val, wt) << endl;
+
+    vector<int> price = {1, 5, 8, 9, 10, 17, 17, 20};
+    cout << "Rod cutting (N = 8):  " << rod_cut_engine(8, price) << endl;
+
+    // W in the billions, few items → meet in the middle
+    mt19937_64 rng(42);
+    vector<long long> w, v;
+    for (int i = 0; i < 30; i++) w.push_back(1'000'000'000 + rng() % 1'000'000'000), v.push_back(1 + rng() % 1'000'000);
+    KnapsackResult r = KnapsackSolver(w, v).solve(12'000'000'000LL);
+    cout << "30 items, W = 1.2e10: value " << r.value << ", weight " << r.weight << ", "
+         << r.items.size() << " items via " << methodName(r.method) << endl;
+
+    // many items, huge W → reduction + branch and bound
+    w.clear(), v.clear();
+    for (int i = 0; i < 100000; i++) {
+        long long x = 1 + rng() % 1'000'000'000;
+        w.push_back(x), v.push_back(x / 2 + rng() % 1'000'000'000);
+    }
+    r = KnapsackSolver(w, v).solve(5'000'000'000'000LL);
+    cout << "100000 items, W = 5e12: value " << r.value << ", " << r.items.size() << " items via "
+         << methodName(r.method) << (r.optimal ? " (optimal)" : " (state limit hit)") << endl;
+    return 0;
+}
+
+/*
+| Method                     | Time                           | Space                  | Used when                |
+| -------------------------- | ------------------------------ | ---------------------- | ------------------------ |
+| knapsack_tabu              | O(N * W)                       | O(N * W) ints          | -                        |
+| 1D DP + taken bits         | O(N * W)                       | O(W) + N * W bits      | W < 2^22, N*W <= 2^28    |
+| Meet in the middle         | O(2^(N/2))                     | O(2^(N/2))             | N <= 40, 2^(N/2) <= N*W  |
+| Reduction + B&B            | O(N log N) + core search       | O(N)                   | otherwise                |
+The core DP can still explode on adversarial instances; stateLimit caps it
+and the result then says optimal = false (best solution found so far).
+*/
@@ -85,6 +85,81 @@ int editDistance_tabu_so(string& str1, string& str2)
     return prev[m];
 }
 
+/*-----------------------------------------------
+    BIT-PARALLEL (Myers / Hyyrö)
+    Time:  O(n * ceil(m/64))
+    Space: O(256 * ceil(m/64))
+-------------------------------------------------
+In a DP column, vertically adjacent cells differ by
+-1, 0 or +1. Myers stores one column as two bitmasks
+over the shorter string (64 cells per word):
+    Pv bit i = 1 → cell i is one MORE than cell i-1
+    Mv bit i = 1 → cell i is one LESS than cell i-1
+For each character c of the longer string, a fixed
+sequence of AND / OR / XOR / + computes the next
+column's Pv, Mv and the horizontal deltas Ph, Mh.
+The answer is m, adjusted by the horizontal delta of
+the last row at every column.
+
+Longer strings: one block per 64 rows; each block
+passes its last-row horizontal delta (+1 / 0 / -1)
+to the block below, which encodes the addition carry.
+------------------------------------------------*/
+
+// One 64-row block of one column; returns the horizontal
+// delta of row `outBit` (-1, 0, +1) for the block below.
+static inline int myersBlock(uint64_t &Pv, uint64_t &Mv, uint64_t Eq, int hin, int outBit)
+{
+    uint64_t hinNeg = hin < 0 ? 1 : 0;
+    uint64_t Xv = Eq | Mv;
+    Eq |= hinNeg;
+    uint64_t Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+    uint64_t Ph = Mv | ~(Xh | Pv);
+    uint64_t Mh = Pv & Xh;
+    int hout = (int)(Ph >> outBit & 1) - (int)(Mh >> outBit & 1);
+    Ph = Ph << 1 | (hin > 0 ? 1 : 0);
+    Mh = Mh << 1 | hinNeg;
+    Pv = Mh | ~(Xv | Ph);
+    Mv = Ph & Xv;
+    return hout;
+}
+
+int editDistance_bitparallel(string& str1, string& str2)
+{
+    string &a = str1.size() <= str2.size() ? str1 : str2;   // bits
+    string &b = str1.size() <= str2.size() ? str2 : str1;   // columns
+    int m = a.size();
+    if (m == 0) return b.size();
+
+    int W = (m + 63) / 64;
+    int lastBit = (m - 1) % 64;
+    int score = m;
+
+    // Short strings: single word, first-row delta is always +1
+    if (W == 1)
+    {
+        uint64_t Peq[256] = {};
+        for (int i = 0; i < m; i++) Peq[(unsigned char)a[i]] |= 1ULL << i;
+        uint64_t Pv = ~0ULL, Mv = 0;
+        for (unsigned char c : b)
+            score += myersBlock(Pv, Mv, Peq[c], +1, lastBit);
+        return score;
+    }
+
+    vector<uint64_t> Peq(256 * W, 0), Pv(W, ~0ULL), Mv(W, 0);
+    for (int i = 0; i < m; i++) Peq[(unsigned char)a[i] * W + i / 64] |= 1ULL << (i % 64);
+
+    for (unsigned char c : b)
+    {
+        const uint64_t *Eq = &Peq[c * W];
+        int h = +1;
+        for (int k = 0; k < W; k++)
+            h = myersBlock(Pv[k], Mv[k], Eq[k], h, k == W - 1 ? lastBit : 63);
+        score += h;
+    }
+    return score;
+}
+
 int main() {
     string s1 = "horse", s2 = "ros";
 
@@ -93,6 +168,7 @@ int main() {
     cout << "Memoized: " << editDistance_memo(s1.size()-1, s2.size()-1, s1, s2, dp) << "\n";
     cout << "Tabulation: " << editDistance_tabu(s1, s2) << "\n";
     cout << "Space Optimized: " << editDistance_tabu_so(s1, s2) << "\n";
+    cout << "Bit-parallel: " << editDistance_bitparallel(s1, s2) << "\n";
 
     return 0;
 }
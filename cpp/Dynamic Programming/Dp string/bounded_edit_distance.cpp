@@ -0,0 +1,191 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*------------------------------------------------------
+    BOUNDED EDIT DISTANCE:  "is the distance <= k ?"
+
+    editDistance_tabu (Edit_Distance.cpp) and
+    min_operation_toconvertString (insert + delete only)
+    always fill the whole (n+1) x (m+1) table, even when
+    all we want to know is whether the strings are within
+    k edits. Most such comparisons are rejects.
+
+    Two observations:
+    - a cell (i, j) with |i - j| > k already costs more
+      than k edits → only the diagonal BAND of width 2k+1
+      can matter (Ukkonen).
+    - from cell (i, j) at least |(n - i) - (m - j)| more
+      edits are needed → once every cell of a row plus that
+      lower bound exceeds k, the answer is "exceeds" and we
+      stop right there.
+
+    Diagonal transition (Landau–Vishkin), for small k on
+    long strings:
+    - L[d] = furthest row reachable on diagonal d = j - i
+      with e edits. Runs of equal characters are free, so
+      they are skipped in one "slide".
+    - e = 0, 1, 2, ...: each step extends 2e+1 diagonals;
+      stop when diagonal m-n reaches row n.
+    - work is O(k^2 + length of the slides), not O(n * k).
+
+    Both modes return -1 when the distance exceeds maxDist.
+-------------------------------------------------------*/
+
+enum class EditOps
+{
+    Levenshtein, // insert, delete, replace (Edit_Distance.cpp)
+    IndelOnly    // insert, delete (min_operation_toconvert_str1_str2.cpp)
+};
+
+/*------------------------------------------------------
+    1) BANDED DP (Ukkonen)
+    Time Complexity:  O(n * k), usually far less (early exit)
+    Space Complexity: O(k)
+-------------------------------------------------------*/
+int editDistance_band(const string &s1, const string &s2, int maxDist, EditOps ops)
+{
+    int n = s1.size(), m = s2.size();
+    if (maxDist < 0 || abs(n - m) > maxDist)
+        return -1;
+    int k = min(maxDist, n + m);
+    int W = 2 * k + 1;
+    const int INF = k + 1; // anything above k is "too far"
+
+    // row[t] = cell (i, j = i + t - k - 1), values capped at INF;
+    // t = 0 and t = W + 1 are sentinels just outside the band
+    vector<int> prev(W + 2, INF), curr(W + 2, INF);
+    for (int j = 0; j <= min(k, m); j++)
+        prev[j + k + 1] = j;
+
+    for (int i = 1; i <= n; i++)
+    {
+        int lo = max(0, i - k), hi = min(m, i + k);
+        int best = INF;
+        fill(curr.begin(), curr.end(), INF);
+
+        for (int j = lo; j <= hi; j++)
+        {
+            int t = j - i + k + 1;
+            int val;
+            if (j == 0)
+                val = i;
+            else if (s1[i - 1] == s2[j - 1])
+                val = prev[t];
+            else
+            {
+                val = 1 + min(prev[t + 1], curr[t - 1]); // delete, insert
+                if (ops == EditOps::Levenshtein)
+                    val = min(val, 1 + prev[t]); // replace
+            }
+            curr[t] = min(val, INF);
+
+            // lower bound on the final distance through this cell
+            best = min(best, curr[t] + abs((n - i) - (m - j)));
+        }
+
+        if (best > k)
+            return -1; // the band is exhausted
+        swap(prev, curr);
+    }
+
+    int ans = prev[m - n + k + 1];
+    return ans <= maxDist ? ans : -1;
+}
+
+/*------------------------------------------------------
+    2) DIAGONAL TRANSITION (Landau–Vishkin)
+    Time Complexity:  O(k^2 + n + m)
+    Space Complexity: O(k)
+-------------------------------------------------------*/
+int editDistance_diagonal(const string &s1, const string &s2, int maxDist, EditOps ops)
+{
+    int n = s1.size(), m = s2.size();
+    if (maxDist < 0 || abs(n - m) > maxDist)
+        return -1;
+    int k = min(maxDist, n + m);
+    const int NONE = INT_MIN / 2;
+
+    // L[d + k + 1] for d in [-k-1, k+1]; outer entries stay NONE
+    vector<int> L(2 * k + 3, NONE), next(2 * k + 3, NONE);
+
+    // follow equal characters along diagonal d from row i
+    auto slide = [&](int d, int i)
+    {
+        while (i < n && i + d < m && s1[i] == s2[i + d])
+            i++;
+        return i;
+    };
+
+    int target = m - n;
+    L[k + 1] = slide(0, 0);
+    if (target == 0 && L[k + 1] == n)
+        return 0;
+
+    for (int e = 1; e <= k; e++)
+    {
+        for (int d = max(-e, -n); d <= min(e, m); d++)
+        {
+            int x = d + k + 1;
+            int i = max(L[x - 1], L[x + 1] + 1); // insert, delete
+            if (ops == EditOps::Levenshtein)
+                i = max(i, L[x] + 1); // replace
+            else
+                i = max(i, L[x]); // reached with e-2 edits already
+            if (i < 0)
+            {
+                next[x] = NONE;
+                continue;
+            }
+            i = min({i, n, m - d});
+            next[x] = slide(d, i);
+        }
+        swap(L, next);
+        if (abs(target) <= e && L[target + k + 1] >= n)
+            return e;
+    }
+    return -1;
+}
+
+/*------------------------------------------------------
+    Same signatures as the full-table versions, plus maxDist
+-------------------------------------------------------*/
+int editDistance_banded(string &str1, string &str2, int maxDist)
+{
+    return editDistance_band(str1, str2, maxDist, EditOps::Levenshtein);
+}
+
+int min_operation_toconvertString_banded(string &s1, string &s2, int maxDist)
+{
+    return editDistance_band(s1, s2, maxDist, EditOps::IndelOnly);
+}
+
+int main()
+{
+    string s1 = "horse", s2 = "ros";
+    cout << "Edit distance <= 3 (band):      " << editDistance_banded(s1, s2, 3) << "\n";
+    cout << "Edit distance <= 2 (band):      " << editDistance_banded(s1, s2, 2) << "\n";
+    cout << "Edit distance <= 3 (diagonal):  "
+         << editDistance_diagonal(s1, s2, 3, EditOps::Levenshtein) << "\n";
+
+    string a = "heap", b = "pea";
+    cout << "Insert/delete ops <= 3:         " << min_operation_toconvertString_banded(a, b, 3) << "\n";
+
+    // long strings, tiny k: diagonal transition only slides
+    string x(100000, 'a'), y = x;
+    y[50000] = 'b';
+    y.insert(70000, "c");
+    cout << "Long strings, distance <= 2:    "
+         << editDistance_diagonal(x, y, 2, EditOps::Levenshtein) << "\n";
+    cout << "Long strings, distance <= 1:    "
+         << editDistance_diagonal(x, y, 1, EditOps::Levenshtein) << "\n";
+    return 0;
+}
+
+/*
+| Mode                 | Time                    | Space  | Best for                     |
+| -------------------- | ----------------------- | ------ | ---------------------------- |
+| Full table (tabu)    | O(n * m)                | O(m)   | exact distance, any size     |
+| Band (Ukkonen)       | O(n * k), early exit    | O(k)   | moderate k, quick rejects    |
+| Diagonal (L–V)       | O(k^2 + n + m)          | O(k)   | small k on long strings      |
+Both bounded modes return -1 as soon as the distance is known to exceed maxDist.
+*/
@@ -0,0 +1,378 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*---------------------------------------------------------------
+    COMPILED WILDCARD / GLOB MATCHING
+    Same language as WildcardMatching_tabu_so:
+    '?' matches exactly 1 char, '*' matches 0+ chars.
+
+    The DP re-reads the pattern for every text, O(n*m) each.
+    When one pattern is checked against many texts (or many
+    patterns against one text) the pattern work can be done once.
+
+    1) ONE PATTERN → CompiledGlob
+    - Split the pattern at '*':  head * s1 * s2 * ... * tail
+    - head must match at the start, tail at the end (fixed
+      lengths, '?' allowed), and s1, s2, ... must appear in
+      this order in between.
+    - Taking the LEFTMOST occurrence of every middle segment
+      is always safe: it leaves the most text for the rest.
+    - Each segment is found with Shift-And (bit i of the
+      state = "segment[0..i] matches ending here"), which
+      handles '?' for free: its bit is set in every char mask.
+    - The scan position only moves forward → O(m * ⌈len/64⌉).
+
+    2) MANY PATTERNS → GlobSet (lazy DFA)
+    - All patterns go into one TRIE ('*' and '?' are edge
+      labels too); NFA state = trie node = a pattern prefix.
+      Rules sharing a prefix ("/api/v1/...") share states.
+    - A node reached by '*' loops on every char, and a '*'
+      edge may be skipped (matches nothing).
+    - A DFA state = the SET of NFA states alive after some
+      prefix of the text. It is built only when first reached
+      and its transitions are cached per byte, so after warm-up
+      every text char is ONE table lookup for all patterns.
+    - Each DFA state remembers which patterns accept in it.
+    - Cache over its memory budget → it is flushed and rebuilt
+      on demand (memory stays bounded on adversarial inputs).
+----------------------------------------------------------------*/
+
+/*---------------------------------------------------------------
+    1) SINGLE PATTERN
+    Compile: O(256 * n)  Match: O(m * ⌈segment/64⌉), O(n / 64) extra
+----------------------------------------------------------------*/
+class CompiledGlob
+{
+public:
+    explicit CompiledGlob(const string &pattern)
+    {
+        string cur;
+        for (char c : pattern)
+        {
+            if (c == '*')
+                segments.emplace_back(cur), cur.clear();
+            else
+                cur += c;
+        }
+        segments.emplace_back(cur);
+        hasStar = segments.size() > 1;
+    }
+
+    bool match(const string &text) const
+    {
+        size_t m = text.size();
+        const Segment &head = segments.front(), &tail = segments.back();
+        if (!hasStar)
+            return head.size() == m && head.matchesAt(text, 0);
+
+        if (head.size() + tail.size() > m || !head.matchesAt(text, 0) || !tail.matchesAt(text, m - tail.size()))
+            return false;
+
+        size_t pos = head.size(), end = m - tail.size();
+        for (size_t k = 1; k + 1 < segments.size(); k++)
+        {
+            long long at = segments[k].find(text, pos, end);
+            if (at < 0)
+                return false;
+            pos = at + segments[k].size();
+        }
+        return true;
+    }
+
+private:
+    // a '*'-free piece of the pattern, with its Shift-And masks
+    class Segment
+    {
+    public:
+        explicit Segment(const string &s) : lit(s), words((s.size() + 63) / 64)
+        {
+            masks.assign(256 * words, 0);
+            for (size_t i = 0; i < s.size(); i++)
+                for (int c = 0; c < 256; c++)
+                    if (s[i] == '?' || (unsigned char)s[i] == c)
+                        masks[c * words + i / 64] |= 1ULL << (i % 64);
+        }
+
+        size_t size() const { return lit.size(); }
+
+        bool matchesAt(const string &text, size_t at) const
+        {
+            for (size_t i = 0; i < lit.size(); i++)
+                if (lit[i] != '?' && lit[i] != text[at + i])
+                    return false;
+            return true;
+        }
+
+        // leftmost start of an occurrence inside text[from, to), or -1
+        long long find(const string &text, size_t from, size_t to) const
+        {
+            if (lit.empty())
+                return from;
+            vector<uint64_t> D(words, 0);
+            int lastWord = (lit.size() - 1) / 64;
+            uint64_t lastBit = 1ULL << ((lit.size() - 1) % 64);
+            for (size_t j = from; j < to; j++)
+            {
+                const uint64_t *M = &masks[(unsigned char)text[j] * words];
+                uint64_t carry = 1; // a match may start at j
+                for (int w = 0; w < words; w++)
+                {
+                    uint64_t next = D[w] >> 63;
+                    D[w] = ((D[w] << 1) | carry) & M[w];
+                    carry = next;
+                }
+                if (D[lastWord] & lastBit)
+                    return j + 1 - lit.size();
+            }
+            return -1;
+        }
+
+    private:
+        string lit;
+        int words;
+        vector<uint64_t> masks; // masks[c * words + w]
+    };
+
+    vector<Segment> segments;
+    bool hasStar;
+};
+
+/*---------------------------------------------------------------
+    2) MANY PATTERNS (lazy DFA over the combined NFA)
+    Match: O(m) table lookups once the states are cached
+    Not thread-safe (the cache grows while matching):
+    use one GlobSet per thread.
+----------------------------------------------------------------*/
+class GlobSet
+{
+public:
+    // cacheBytes bounds the memory of the cached DFA states
+    explicit GlobSet(size_t cacheBytes = 64 << 20) : cacheBytes(cacheBytes)
+    {
+        nodes.emplace_back(); // trie root
+    }
+
+    // returns the id of the pattern (0, 1, 2, ... in insertion order)
+    int add(const string &pattern)
+    {
+        int u = 0;
+        for (size_t i = 0; i < pattern.size(); i++)
+        {
+            char c = pattern[i];
+            if (c == '*' && i > 0 && pattern[i - 1] == '*')
+                continue; // "**" = "*"
+            int &child = c == '*'   ? nodes[u].star
+                         : c == '?' ? nodes[u].any
+                                    : nodes[u].lit.emplace((unsigned char)c, -1).first->second;
+            if (child >= 0)
+            {
+                u = child;
+                continue;
+            }
+            child = u = nodes.size(); // before emplace_back moves the nodes
+            nodes.emplace_back();
+            nodes[u].isStar = c == '*';
+        }
+        nodes[u].accepts.push_back(patterns);
+        flush(); // the old DFA does not know the new pattern
+        return patterns++;
+    }
+
+    // ids of all patterns matching text, ascending
+    vector<int> matchAll(const string &text)
+    {
+        int s = run(text);
+        return s < 0 ? vector<int>() : dfa[s].accepts;
+    }
+
+    bool matchAny(const string &text)
+    {
+        int s = run(text);
+        return s >= 0 && !dfa[s].accepts.empty();
+    }
+
+    size_t cachedStates() const { return dfa.size(); }
+
+private:
+    // trie of the patterns: NFA state = trie node = a pattern prefix
+    struct Node
+    {
+        map<unsigned char, int> lit;
+        int any = -1, star = -1;
+        bool isStar = false; // reached by '*' → loops on every char
+        vector<int> accepts; // patterns ending here
+    };
+
+    struct DState
+    {
+        vector<int> nfa;     // sorted trie nodes
+        vector<int> accepts; // patterns ending in one of them
+        array<int, 256> next;
+    };
+
+    struct SetHash
+    {
+        size_t operator()(const vector<int> &v) const
+        {
+            uint64_t h = v.size();
+            for (int x : v)
+                h = (h ^ (uint64_t)x) * 0x9E3779B97F4A7C15ULL;
+            return h ^ (h >> 32);
+        }
+    };
+
+    vector<Node> nodes;
+    int patterns = 0;
+    vector<DState> dfa;
+    unordered_map<vector<int>, int, SetHash> index;
+    vector<int> seenAt; // seenAt[u] == stamp → u already in the set being built
+    int stamp = 0;
+    size_t cacheBytes, usedBytes = 0;
+
+    void flush()
+    {
+        dfa.clear();
+        index.clear();
+        usedBytes = 0;
+    }
+
+    // u plus the node after a following '*' (it may match nothing)
+    void closure(int u, vector<int> &out)
+    {
+        while (u >= 0 && seenAt[u] != stamp)
+        {
+            seenAt[u] = stamp;
+            out.push_back(u);
+            u = nodes[u].star;
+        }
+    }
+
+    int intern(vector<int> &set)
+    {
+        sort(set.begin(), set.end());
+        auto it = index.find(set);
+        if (it != index.end())
+            return it->second;
+
+        DState d;
+        d.nfa = set;
+        d.next.fill(-1);
+        for (int u : set)
+            d.accepts.insert(d.accepts.end(), nodes[u].accepts.begin(), nodes[u].accepts.end());
+        sort(d.accepts.begin(), d.accepts.end());
+        // the state, its set twice (state + index key) and its accepts
+        usedBytes += sizeof(DState) + 64 + (2 * set.size() + d.accepts.size()) * sizeof(int);
+        dfa.push_back(move(d));
+        return index[set] = dfa.size() - 1;
+    }
+
+    int start()
+    {
+        seenAt.resize(nodes.size(), -1);
+        stamp++;
+        vector<int> set;
+        closure(0, set);
+        return intern(set);
+    }
+
+    int step(int from, unsigned char c)
+    {
+        stamp++;
+        vector<int> set;
+        for (int u : dfa[from].nfa)
+        {
+            const Node &nd = nodes[u];
+            if (nd.isStar)
+                closure(u, set); // '*' eats c and stays
+            closure(nd.any, set);
+            auto it = nd.lit.find(c);
+            if (it != nd.lit.end())
+                closure(it->second, set);
+        }
+        int to = intern(set);
+        dfa[from].next[c] = to;
+        return to;
+    }
+
+    // final DFA state after reading text, -1 if no pattern is alive
+    int run(const string &text)
+    {
+        if (patterns == 0)
+            return -1;
+        int s = dfa.empty() ? start() : 0; // state 0 is always the start
+        for (unsigned char c : text)
+        {
+            int t = dfa[s].next[c];
+            if (t < 0)
+            {
+                if (usedBytes >= cacheBytes)
+                {
+                    // cache full: start over, keeping only the state we are in
+                    vector<int> cur = dfa[s].nfa;
+                    flush();
+                    start();
+                    s = intern(cur);
+                }
+                t = step(s, c);
+            }
+            s = t;
+            if (dfa[s].nfa.empty())
+                return -1; // dead state: nothing can match any more
+        }
+        return s;
+    }
+};
+
+/*---------------------------------------------------------------
+    Same signature as the DP versions
+----------------------------------------------------------------*/
+bool WildcardMatching_compiled(string &pattern, string &text)
+{
+    return CompiledGlob(pattern).match(text);
+}
+
+/*---------------------------------------------------------------
+    MAIN FUNCTION
+----------------------------------------------------------------*/
+int main()
+{
+    string pattern = "a*b?c";
+    string text = "axxbbzc";
+    cout << "Compiled Result: " << WildcardMatching_compiled(pattern, text) << "\n";
+
+    // one pattern, many texts
+    CompiledGlob glob("*.log");
+    for (string f : {"app.log", "app.log.1", ".log", "log"})
+        cout << f << " matches *.log: " << glob.match(f) << "\n";
+
+    // ACL style: many globs, every request path checked against all
+    GlobSet acl;
+    vector<string> rules = {"/api/*", "/api/v?/users/*", "*.php", "/static/*/img/*", "/admin"};
+    for (string &r : rules)
+        acl.add(r);
+    for (string path : {"/api/v1/users/42", "/index.php", "/static/a/b/img/x.png", "/admin", "/home"})
+    {
+        cout << path << " →";
+        for (int id : acl.matchAll(path))
+            cout << " " << rules[id];
+        cout << "\n";
+    }
+
+    // thousands of rules
+    GlobSet big;
+    for (int i = 0; i < 5000; i++)
+        big.add("/tenant" + to_string(i) + "/*/file?.txt");
+    string path = "/tenant4711/docs/2024/file7.txt";
+    cout << "5000 rules, matches for " << path << ": " << big.matchAll(path).size()
+         << " (cached DFA states: " << big.cachedStates() << ")\n";
+    return 0;
+}
+
+/*
+| Method                      | Preprocess | Per text                         | Space          |
+| --------------------------- | ---------- | -------------------------------- | -------------- |
+| WildcardMatching_tabu_so    | -          | O(n * m)                         | O(m)           |
+| CompiledGlob (Shift-And)    | O(256 * n) | O(m * ⌈segment/64⌉)              | O(256 * n / 64)|
+| GlobSet (lazy DFA)          | O(Σ n)     | O(m) lookups once states cached  | ≤ cacheBytes   |
+n = pattern length, m = text length, Σ n = all patterns together.
+*/
@@ -0,0 +1,261 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*------------------------------------------------------
+    LINEAR-SPACE LCS / SCS / EDIT SCRIPT (Hirschberg)
+
+    printLcs (print_lcs.cpp) and shortest_common_superseq
+    (shortest_common_subsequence.cpp) keep the whole
+    (n+1) x (m+1) lcs_tabu table only to walk back through
+    it once. For two 200k-line files that is 4 * 10^10 ints.
+
+    Intuition:
+    - The 1-row LCS (lcs_tabu_so) gives the LCS of a prefix
+      of s1 against EVERY prefix of s2 in O(m) memory.
+    - Split s1 in the middle: s1 = L + R.
+        F[k] = LCS(L, s2[0..k))          (forward rows)
+        B[k] = LCS(R, s2[k..m))          (rows on reversed strings)
+      The best alignment crosses the middle at the k that
+      maximises F[k] + B[k].
+    - Recurse on (L, s2[0..k)) and (R, s2[k..m)). The two
+      halves are independent → the big ones run on their own
+      threads, and F / B of one split are computed in parallel.
+    - Small blocks (≤ BASE_CELLS cells) are solved with the
+      ordinary table, which is constant-size memory.
+
+    The result is an EDIT SCRIPT of Keep / Delete / Insert:
+        Keep    → element is in the LCS
+        Delete  → only in s1
+        Insert  → only in s2
+    LCS = the Keep elements, SCS = every element in order,
+    and the script itself is a line diff when the sequences
+    are lines (any vector<T> with == works, e.g. line hashes).
+-------------------------------------------------------*/
+
+enum class EditOp : char
+{
+    Keep,
+    Delete,
+    Insert
+};
+
+template <class Seq>
+class Hirschberg
+{
+public:
+    Hirschberg(const Seq &a, const Seq &b, int threads) : a(a), b(b)
+    {
+        // every thread level doubles the number of running workers
+        for (int t = 1; t < threads; t *= 2)
+            parallelDepth++;
+    }
+
+    vector<EditOp> script()
+    {
+        int n = a.size(), m = b.size();
+        vector<EditOp> out(n + m); // upper bound; trimmed below
+        int lcs = solve(0, n, 0, m, out.data(), 0);
+        out.resize(n + m - lcs);
+        return out;
+    }
+
+private:
+    static const long long BASE_CELLS = 1 << 12;
+    static const long long PARALLEL_CELLS = 1 << 22;
+    const Seq &a, &b;
+    int parallelDepth = 0;
+
+    // Aligns a[aLo..aHi) with b[bLo..bHi), writes its script at out,
+    // returns the LCS length of the block
+    int solve(int aLo, int aHi, int bLo, int bHi, EditOp *out, int depth)
+    {
+        int n = aHi - aLo, m = bHi - bLo;
+        if (n == 0 || m == 0)
+        {
+            fill(out, out + n, EditOp::Delete);
+            fill(out + n, out + n + m, EditOp::Insert);
+            return 0;
+        }
+        if ((long long)n * m <= BASE_CELLS || n == 1)
+            return solveTable(aLo, aHi, bLo, bHi, out);
+
+        int mid = aLo + n / 2;
+        bool parallel = depth < parallelDepth && (long long)n * m >= PARALLEL_CELLS;
+
+        // F[k] = LCS(a[aLo..mid), b[bLo..bLo+k)); B[k] = LCS(a[mid..aHi), b[bLo+k..bHi))
+        vector<int> F, B;
+        if (parallel)
+        {
+            thread t([&]() { B = backwardRow(mid, aHi, bLo, bHi); });
+            F = forwardRow(aLo, mid, bLo, bHi);
+            t.join();
+        }
+        else
+        {
+            F = forwardRow(aLo, mid, bLo, bHi);
+            B = backwardRow(mid, aHi, bLo, bHi);
+        }
+
+        int split = 0;
+        for (int k = 1; k <= m; k++)
+            if (F[k] + B[k] > F[split] + B[split])
+                split = k;
+        int leftLcs = F[split], total = F[split] + B[split];
+        vector<int>().swap(F); // free before recursing
+        vector<int>().swap(B);
+
+        // left block's script length is known → right writes after it
+        EditOp *rightOut = out + (mid - aLo) + split - leftLcs;
+        if (parallel)
+        {
+            thread t([&]() { solve(aLo, mid, bLo, bLo + split, out, depth + 1); });
+            solve(mid, aHi, bLo + split, bHi, rightOut, depth + 1);
+            t.join();
+        }
+        else
+        {
+            solve(aLo, mid, bLo, bLo + split, out, depth + 1);
+            solve(mid, aHi, bLo + split, bHi, rightOut, depth + 1);
+        }
+        return total;
+    }
+
+    // 1-row LCS of a[aLo..aHi) against every prefix of b[bLo..bHi)
+    vector<int> forwardRow(int aLo, int aHi, int bLo, int bHi)
+    {
+        int m = bHi - bLo;
+        vector<int> row(m + 1, 0);
+        for (int i = aLo; i < aHi; i++)
+        {
+            int diag = 0; // row[j - 1] of the previous row
+            for (int j = 1; j <= m; j++)
+            {
+                int up = row[j];
+                row[j] = a[i] == b[bLo + j - 1] ? diag + 1 : max(up, row[j - 1]);
+                diag = up;
+            }
+        }
+        return row;
+    }
+
+    // row[k] = LCS of a[aLo..aHi) against the suffix b[bLo+k..bHi)
+    vector<int> backwardRow(int aLo, int aHi, int bLo, int bHi)
+    {
+        int m = bHi - bLo;
+        vector<int> row(m + 1, 0);
+        for (int i = aHi - 1; i >= aLo; i--)
+        {
+            int diag = 0;
+            for (int k = m - 1; k >= 0; k--)
+            {
+                int down = row[k];
+                row[k] = a[i] == b[bLo + k] ? diag + 1 : max(down, row[k + 1]);
+                diag = down;
+            }
+        }
+        return row;
+    }
+
+    // small block: full table + the usual walk back (as in printLcs)
+    int solveTable(int aLo, int aHi, int bLo, int bHi, EditOp *out)
+    {
+        int n = aHi - aLo, m = bHi - bLo;
+        vector<vector<int>> dp(n + 1, vector<int>(m + 1, 0));
+        for (int i = 1; i <= n; i++)
+            for (int j = 1; j <= m; j++)
+                dp[i][j] = a[aLo + i - 1] == b[bLo + j - 1] ? 1 + dp[i - 1][j - 1]
+                                                            : max(dp[i - 1][j], dp[i][j - 1]);
+
+        int len = n + m - dp[n][m];
+        int i = n, j = m, idx = len - 1;
+        while (i > 0 || j > 0)
+        {
+            if (i > 0 && j > 0 && a[aLo + i - 1] == b[bLo + j - 1])
+                out[idx--] = EditOp::Keep, i--, j--;
+            else if (j == 0 || (i > 0 && dp[i - 1][j] > dp[i][j - 1]))
+                out[idx--] = EditOp::Delete, i--;
+            else
+                out[idx--] = EditOp::Insert, j--;
+        }
+        return dp[n][m];
+    }
+};
+
+template <class Seq>
+vector<EditOp> editScript_linear(const Seq &a, const Seq &b,
+                                 int threads = max(1u, thread::hardware_concurrency()))
+{
+    return Hirschberg<Seq>(a, b, threads).script();
+}
+
+/*------------------------------------------------------
+    Same lengths as printLcs / shortest_common_superseq,
+    O(n + m) memory
+-------------------------------------------------------*/
+string printLcs_linear(string &s1, string &s2)
+{
+    string ans;
+    int i = 0;
+    for (EditOp op : editScript_linear(s1, s2))
+    {
+        if (op == EditOp::Keep)
+            ans += s1[i];
+        if (op != EditOp::Insert)
+            i++;
+    }
+    return ans;
+}
+
+string shortest_common_superseq_linear(string &s1, string &s2)
+{
+    string ans;
+    int i = 0, j = 0;
+    for (EditOp op : editScript_linear(s1, s2))
+    {
+        if (op == EditOp::Insert)
+            ans += s2[j++];
+        else
+        {
+            ans += s1[i++];
+            if (op == EditOp::Keep)
+                j++;
+        }
+    }
+    return ans;
+}
+
+/*------------------------------------------------------
+                       MAIN FUNCTION
+-------------------------------------------------------*/
+int main()
+{
+    string s1 = "abcde", s2 = "ace";
+    cout << "LCS string: " << printLcs_linear(s1, s2) << endl;
+
+    string t1 = "brute", t2 = "groot";
+    cout << "Shortest Common Supersequence = " << shortest_common_superseq_linear(t1, t2) << endl;
+
+    // line diff: sequences of lines instead of characters
+    vector<string> oldLines = {"int main()", "{", "    int x = 1;", "    return x;", "}"};
+    vector<string> newLines = {"int main()", "{", "    int x = 2;", "    x++;", "    return x;", "}"};
+    int i = 0, j = 0;
+    for (EditOp op : editScript_linear(oldLines, newLines))
+    {
+        if (op == EditOp::Keep)
+            cout << "  " << oldLines[i++] << endl, j++;
+        else if (op == EditOp::Delete)
+            cout << "- " << oldLines[i++] << endl;
+        else
+            cout << "+ " << newLines[j++] << endl;
+    }
+    return 0;
+}
+
+/*
+| Step                     | Time                 | Space                  |
+| ------------------------ | -------------------- | ---------------------- |
+| Full table (lcs_tabu)    | O(n * m)             | O(n * m)               |
+| Hirschberg               | O(n * m) (~2x cells) | O(n + m)               |
+| Parallel Hirschberg      | O(n * m / threads)   | O(n + m) per thread    |
+The recursion depth is O(log n); only two rows are alive per running split.
+*/
@@ -104,6 +104,84 @@ int lcs_tabu_so(string &s1, string &s2)
 
 
 
+/*------------------------------------------------------
+    4) BIT-PARALLEL (Allison–Dix / Hyyrö)
+    Time Complexity:  O(n * ceil(m/64))
+    Space Complexity: O(256 * ceil(m/64))
+-------------------------------------------------------
+Intuition:
+- In one row of the DP, neighbouring cells differ by 0 or 1.
+  So a row is fully described by WHERE it steps up: one bit
+  per column of the shorter string (64 columns per word).
+- V has bit j = 0  ⇔  the row steps up at column j.
+  LCS = number of zero bits in V after the last row.
+- match[c] = bitmask of positions where the shorter string has c.
+- One DP row for character c of the longer string is just:
+        U = V & match[c]
+        V = (V + U) | (V - U)
+  The addition carries the "take a match" decision to the next
+  column on its own, 64 cells at a time.
+- Longer strings: an array of words, the carry of each word's
+  addition flows into the next one.
+-------------------------------------------------------*/
+int lcs_bitparallel(string &s1, string &s2)
+{
+    string &a = s1.size() <= s2.size() ? s1 : s2;   // bits
+    string &b = s1.size() <= s2.size() ? s2 : s1;   // rows
+    int m = a.size();
+    if (m == 0)
+        return 0;
+
+    // Short strings: everything in one machine word
+    if (m <= 64)
+    {
+        uint64_t match[256] = {};
+        for (int j = 0; j < m; j++)
+            match[(unsigned char)a[j]] |= 1ULL << j;
+
+        uint64_t V = ~0ULL;
+        for (unsigned char c : b)
+        {
+            uint64_t U = V & match[c];
+            V = (V + U) | (V - U);
+        }
+        uint64_t mask = m == 64 ? ~0ULL : (1ULL << m) - 1;
+        return m - __builtin_popcountll(V & mask);
+    }
+
+    int W = (m + 63) / 64;
+    vector<uint64_t> match(256 * W, 0), V(W, ~0ULL);
+    for (int j = 0; j < m; j++)
+        match[(unsigned char)a[j] * W + j / 64] |= 1ULL << (j % 64);
+
+    for (unsigned char c : b)
+    {
+        const uint64_t *M = &match[c * W];
+        uint64_t carry = 0;
+        for (int k = 0; k < W; k++)
+        {
+            uint64_t U = V[k] & M[k];
+            uint64_t sum = V[k] + U;
+            uint64_t c1 = sum < V[k];
+            sum += carry;
+            carry = c1 | (sum < carry);
+            V[k] = sum | (V[k] - U);
+        }
+    }
+
+    int ones = 0;
+    for (int k = 0; k < W; k++)
+    {
+        uint64_t word = V[k];
+        if (k == W - 1 && m % 64)
+            word &= (1ULL << (m % 64)) - 1;
+        ones += __builtin_popcountll(word);
+    }
+    return m - ones;
+}
+
+
+
 /*------------------------------------------------------
                     MAIN FUNCTION
 -------------------------------------------------------*/
@@ -125,5 +203,8 @@ int main()
     cout << "LCS (Space Optimized):    " 
          << lcs_tabu_so(s1, s2) << endl;
 
+    cout << "LCS (Bit-parallel):       " 
+         << lcs_bitparallel(s1, s2) << endl;
+
     return 0;
 }
@@ -0,0 +1,434 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/*------------------------------------------------------
+    MYERS O(ND) DIFF  (line / token level, unified output)
+
+    printLcs (print_lcs.cpp) answers the same question a
+    diff does: keep the LCS, delete the rest of file 1,
+    insert the rest of file 2. But lcs_tabu is O(n * m)
+    time AND memory, and real files that differ in a few
+    lines are the common case.
+
+    1️⃣ Read both files through mmap; split into lines
+       (string_view, no copies).
+    2️⃣ Hash every distinct line to a small integer (one
+       shared table for both files) → comparing two lines
+       is one int comparison.
+    3️⃣ Strip the common prefix and suffix first: unchanged
+       headers / footers cost O(length), nothing more.
+    4️⃣ Myers: D = number of inserted + deleted lines.
+       V[k] = furthest x reached on diagonal k = x - y with
+       d edits; equal runs ("snakes") are followed for free.
+       Running the search from both ends at once finds the
+       MIDDLE SNAKE of an optimal path after D/2 rounds;
+       recursing on the two halves gives the whole script
+       in O((N + M) * D) time and O(N + M) memory.
+    5️⃣ Print unified-diff hunks with 3 context lines
+       (same format as diff -u / git diff), or a word diff
+       with [-removed-]{+added+} at token level.
+-------------------------------------------------------*/
+
+enum class DiffOp : char
+{
+    Keep,   // in both (part of the LCS)
+    Delete, // only in the old file
+    Insert  // only in the new file
+};
+
+/*------------------------------------------------------
+    Memory-mapped input file
+-------------------------------------------------------*/
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile()
+    {
+        if (base)
+            munmap(base, len);
+    }
+
+    bool open(const string &path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        bool ok = fstat(fd, &st) == 0;
+        if (ok && st.st_size > 0)
+        {
+            void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+                ok = false;
+            else
+            {
+                base = p;
+                len = st.st_size;
+                madvise(base, len, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+        return ok;
+    }
+
+    string_view text() const { return string_view((const char *)base, len); }
+
+private:
+    void *base = nullptr;
+    size_t len = 0;
+};
+
+/*------------------------------------------------------
+    Splitting + hashing to integers
+-------------------------------------------------------*/
+
+// Lines keep their '\n', so "x" at EOF and "x\n" differ (as in diff)
+vector<string_view> splitLines(string_view text)
+{
+    vector<string_view> lines;
+    size_t start = 0;
+    while (start < text.size())
+    {
+        size_t nl = text.find('\n', start);
+        size_t end = nl == string_view::npos ? text.size() : nl + 1;
+        lines.push_back(text.substr(start, end - start));
+        start = end;
+    }
+    return lines;
+}
+
+vector<string_view> splitTokens(string_view text)
+{
+    vector<string_view> tokens;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        while (i < text.size() && isspace((unsigned char)text[i]))
+            i++;
+        size_t start = i;
+        while (i < text.size() && !isspace((unsigned char)text[i]))
+            i++;
+        if (i > start)
+            tokens.push_back(text.substr(start, i - start));
+    }
+    return tokens;
+}
+
+// Equal pieces get equal ids; ids are dense, so no false matches
+class Interner
+{
+public:
+    vector<int> ids(const vector<string_view> &pieces)
+    {
+        vector<int> out;
+        out.reserve(pieces.size());
+        for (string_view p : pieces)
+            out.push_back(table.emplace(p, (int)table.size()).first->second);
+        return out;
+    }
+
+private:
+    unordered_map<string_view, int> table;
+};
+
+/*------------------------------------------------------
+    Myers diff with the linear-space middle snake
+-------------------------------------------------------*/
+class MyersDiff
+{
+public:
+    vector<DiffOp> diff(const vector<int> &oldSeq, const vector<int> &newSeq)
+    {
+        a = &oldSeq;
+        b = &newSeq;
+        ops.clear();
+        solve(0, a->size(), 0, b->size());
+
+        // inside each changed block, list deletions before insertions (as diff does)
+        for (size_t p = 0; p < ops.size();)
+        {
+            size_t q = p;
+            while (q < ops.size() && ops[q] != DiffOp::Keep)
+                q++;
+            stable_partition(ops.begin() + p, ops.begin() + q, [](DiffOp op) { return op == DiffOp::Delete; });
+            p = q + 1;
+        }
+        return ops;
+    }
+
+private:
+    const vector<int> *a, *b;
+    vector<DiffOp> ops;
+
+    void emit(DiffOp op, int count) { ops.insert(ops.end(), count, op); }
+
+    void solve(int aLo, int aHi, int bLo, int bHi)
+    {
+        // common prefix / suffix are kept as they are
+        int pre = 0;
+        while (aLo + pre < aHi && bLo + pre < bHi && (*a)[aLo + pre] == (*b)[bLo + pre])
+            pre++;
+        emit(DiffOp::Keep, pre);
+        aLo += pre, bLo += pre;
+        int suf = 0;
+        while (aLo < aHi - suf && bLo < bHi - suf && (*a)[aHi - 1 - suf] == (*b)[bHi - 1 - suf])
+            suf++;
+        aHi -= suf, bHi -= suf;
+
+        if (aLo == aHi || bLo == bHi)
+        {
+            emit(DiffOp::Delete, aHi - aLo);
+            emit(DiffOp::Insert, bHi - bLo);
+        }
+        else
+        {
+            auto [x, y] = middleSnake(aLo, aHi, bLo, bHi);
+            if (x < 0)
+            { // nothing in common at all
+                emit(DiffOp::Delete, aHi - aLo);
+                emit(DiffOp::Insert, bHi - bLo);
+            }
+            else
+            {
+                solve(aLo, x, bLo, y);
+                solve(x, aHi, y, bHi);
+            }
+        }
+        emit(DiffOp::Keep, suf);
+    }
+
+    // A point (x, y) on an optimal path; {-1, -1} if the ranges share nothing
+    pair<int, int> middleSnake(int aLo, int aHi, int bLo, int bHi)
+    {
+        int N = aHi - aLo, M = bHi - bLo;
+        int maxD = (N + M + 1) / 2, off = maxD + 1;
+        int delta = N - M;
+        bool oddDelta = delta % 2 != 0;
+        // vf[k + off]: furthest x on diagonal k from the start;
+        // vb[k + off]: furthest x on diagonal k from the end (reversed)
+        vector<int> vf(2 * off + 2, -1), vb(2 * off + 2, -1);
+        vf[off + 1] = 0;
+        vb[off + 1] = 0;
+        // diagonals that ran off the grid are skipped from then on
+        int fStart = 0, fEnd = 0, bStart = 0, bEnd = 0;
+
+        auto A = [&](int i) { return (*a)[aLo + i]; };
+        auto B = [&](int j) { return (*b)[bLo + j]; };
+
+        for (int d = 0; d < maxD; d++)
+        {
+            for (int k = -d + fStart; k <= d - fEnd; k += 2)
+            {
+                int x = (k == -d || (k != d && vf[off + k - 1] < vf[off + k + 1]))
+                            ? vf[off + k + 1]      // down: insert
+                            : vf[off + k - 1] + 1; // right: delete
+                int y = x - k;
+                while (x < N && y < M && A(x) == B(y))
+                    x++, y++;
+                vf[off + k] = x;
+                if (x > N)
+                    fEnd += 2;
+                else if (y > M)
+                    fStart += 2;
+                else if (oddDelta)
+                {
+                    int kb = delta - k;
+                    if (kb >= -maxD && kb <= maxD && vb[off + kb] != -1 && x >= N - vb[off + kb])
+                        return {aLo + x, bLo + y};
+                }
+            }
+            for (int k = -d + bStart; k <= d - bEnd; k += 2)
+            {
+                int x = (k == -d || (k != d && vb[off + k - 1] < vb[off + k + 1]))
+                            ? vb[off + k + 1]
+                            : vb[off + k - 1] + 1;
+                int y = x - k;
+                while (x < N && y < M && A(N - x - 1) == B(M - y - 1))
+                    x++, y++;
+                vb[off + k] = x;
+                if (x > N)
+                    bEnd += 2;
+                else if (y > M)
+                    bStart += 2;
+                else if (!oddDelta)
+                {
+                    int kf = delta - k;
+                    if (kf >= -maxD && kf <= maxD && vf[off + kf] != -1)
+                    {
+                        int xf = vf[off + kf], yf = xf - kf;
+                        if (xf >= N - x)
+                            return {aLo + xf, bLo + yf};
+                    }
+                }
+            }
+        }
+        return {-1, -1};
+    }
+};
+
+/*------------------------------------------------------
+    Unified diff output (diff -u)
+-------------------------------------------------------*/
+void printLine(ostream &out, char tag, string_view line)
+{
+    out << tag << line;
+    if (line.empty() || line.back() != '\n')
+        out << "\n\\ No newline at end of file\n";
+}
+
+// returns the number of hunks printed
+int unifiedDiff(const vector<string_view> &oldLines, const vector<string_view> &newLines,
+                const vector<DiffOp> &ops, ostream &out, const string &oldName,
+                const string &newName, int context = 3)
+{
+    // old / new line index before every op
+    int n = ops.size();
+    vector<int> oi(n + 1), ni(n + 1);
+    for (int p = 0; p < n; p++)
+    {
+        oi[p + 1] = oi[p] + (ops[p] != DiffOp::Insert);
+        ni[p + 1] = ni[p] + (ops[p] != DiffOp::Delete);
+    }
+
+    int hunks = 0;
+    for (int p = 0; p < n;)
+    {
+        if (ops[p] == DiffOp::Keep)
+        {
+            p++;
+            continue;
+        }
+        // hunk: changes separated by at most 2 * context kept lines
+        int first = max(0, p - context), last = p;
+        while (true)
+        {
+            while (last < n && ops[last] != DiffOp::Keep)
+                last++;
+            int q = last;
+            while (q < n && ops[q] == DiffOp::Keep && q - last < 2 * context + 1)
+                q++;
+            if (q < n && ops[q] != DiffOp::Keep && q - last <= 2 * context)
+                last = q;
+            else
+                break;
+        }
+        int end = min(n, last + context);
+
+        if (hunks++ == 0)
+            out << "--- " << oldName << "\n+++ " << newName << "\n";
+        auto range = [&](int start, int count)
+        {
+            string s = to_string(count == 0 ? start : start + 1);
+            return count == 1 ? s : s + "," + to_string(count);
+        };
+        out << "@@ -" << range(oi[first], oi[end] - oi[first]) << " +"
+            << range(ni[first], ni[end] - ni[first]) << " @@\n";
+        for (int q = first; q < end; q++)
+        {
+            if (ops[q] == DiffOp::Keep)
+                printLine(out, ' ', oldLines[oi[q]]);
+            else if (ops[q] == DiffOp::Delete)
+                printLine(out, '-', oldLines[oi[q]]);
+            else
+                printLine(out, '+', newLines[ni[q]]);
+        }
+        p = end;
+    }
+    return hunks;
+}
+
+/*------------------------------------------------------
+    Token level: word diff  [-removed-]{+added+}
+-------------------------------------------------------*/
+void wordDiff(const vector<string_view> &oldTok, const vector<string_view> &newTok,
+              const vector<DiffOp> &ops, ostream &out)
+{
+    int i = 0, j = 0;
+    for (size_t p = 0; p < ops.size(); p++)
+    {
+        if (p)
+            out << ' ';
+        if (ops[p] == DiffOp::Keep)
+            out << oldTok[i++], j++;
+        else if (ops[p] == DiffOp::Delete)
+            out << "[-" << oldTok[i++] << "-]";
+        else
+            out << "{+" << newTok[j++] << "+}";
+    }
+    out << "\n";
+}
+
+// whole pipeline on two in-memory texts
+int diffTexts(string_view oldText, string_view newText, ostream &out, bool tokens,
+              const string &oldName = "a", const string &newName = "b", int context = 3)
+{
+    auto split = tokens ? splitTokens : splitLines;
+    vector<string_view> oldPieces = split(oldText), newPieces = split(newText);
+    Interner interner;
+    vector<int> a = interner.ids(oldPieces), b = interner.ids(newPieces);
+    vector<DiffOp> ops = MyersDiff().diff(a, b);
+
+    if (tokens)
+    {
+        wordDiff(oldPieces, newPieces, ops, out);
+        return count(ops.begin(), ops.end(), DiffOp::Keep) != (long)ops.size();
+    }
+    return unifiedDiff(oldPieces, newPieces, ops, out, oldName, newName, context) > 0;
+}
+
+/*------------------------------------------------------
+                       MAIN FUNCTION
+    ./a.out [-w] [-U n] old new   (exit 1 if they differ)
+    ./a.out                       (built-in example)
+-------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+    bool tokens = false;
+    int context = 3;
+    vector<string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "-w")
+            tokens = true;
+        else if (arg == "-U" && i + 1 < argc)
+            context = atoi(argv[++i]);
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() == 2)
+    {
+        MappedFile oldFile, newFile;
+        if (!oldFile.open(files[0]) || !newFile.open(files[1]))
+        {
+            cerr << "cannot open input files\n";
+            return 2;
+        }
+        return diffTexts(oldFile.text(), newFile.text(), cout, tokens, files[0], files[1], context);
+    }
+
+    string oldCfg = "host = 10.0.0.1\nport = 8080\nworkers = 4\ntimeout = 30\nretries = 3\nlog = info\n";
+    string newCfg = "host = 10.0.0.1\nport = 8081\nworkers = 4\ntimeout = 30\nretries = 3\nlog = debug\ntrace = on\n";
+    diffTexts(oldCfg, newCfg, cout, false, "old.conf", "new.conf", 1);
+    diffTexts("the quick brown fox jumps", "the quick red fox jumped", cout, true);
+    return 0;
+}
+
+/*
+| Step                    | Time                     | Space     |
+| ----------------------- | ------------------------ | --------- |
+| mmap + split + hash     | O(N + M) bytes           | O(N + M)  |
+| prefix / suffix trim    | O(common lines)          | O(1)      |
+| Myers (middle snake)    | O((N + M) * D)           | O(N + M)  |
+| lcs_tabu (for contrast) | O(N * M)                 | O(N * M)  |
+D = number of changed lines: a config with 3 edits in 200k lines costs
+a few passes over the file instead of 4 * 10^10 table cells.
+*/
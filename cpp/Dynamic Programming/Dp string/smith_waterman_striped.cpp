@@ -0,0 +1,335 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*=====================================================================
+    LOCAL ALIGNMENT (Smith–Waterman, affine gaps) — STRIPED VECTORS
+    --------------------------------------------------------------
+    longestCommonSubstring_so is a special local alignment:
+    +1 per match, a mismatch or gap ends the run (reset to 0).
+    Real sequence matching needs
+    - a SCORING MATRIX  score(a, b) per pair of symbols
+    - AFFINE GAPS: opening a gap costs gapOpen, each further
+      gap symbol costs gapExtend (one long gap beats many short)
+
+    Gotoh recurrences (query i, target j):
+        E[i][j] = max(E[i][j-1] - ext, H[i][j-1] - open)   gap in query
+        F[i][j] = max(F[i-1][j] - ext, H[i-1][j] - open)   gap in target
+        H[i][j] = max(0, H[i-1][j-1] + score, E[i][j], F[i][j])
+        answer  = max over all H
+
+    Striped layout (Farrar):
+    - A vector register holds L cells of ONE column. Lane l of
+      segment s holds query row  s + l * segLen  (segLen = m / L),
+      so the vertical dependency i-1 → i stays inside the same lane
+      except at segment borders.
+    - One column = segLen vector steps: H, E and the score profile
+      of the target symbol for L rows at a time.
+    - F (vertical gaps) is first assumed to stop at lane borders;
+      a short "lazy F" pass then pushes it across lanes, and almost
+      always stops after one segment.
+
+    Saturation / overflow:
+    - The first pass uses 16-bit lanes (8 per 128-bit vector).
+      H never drops below 0 and a column never exceeds the best
+      so far + maxScore, so 16 bits are safe while the best score
+      stays below 32767 - maxScore.
+    - If a column gets too close to that limit the alignment is
+      redone with 32-bit lanes (never overflows for real inputs).
+    - Vectors are GCC/Clang vector extensions: the compiler maps
+      them to SSE2 / NEON (+, -, compare, select, no intrinsics).
+======================================================================*/
+
+/*=====================================================================
+    SCORING MATRIX
+======================================================================*/
+class ScoringMatrix
+{
+public:
+    // alphabet[i] ↔ row / column i of scores; other bytes score `unknown`
+    ScoringMatrix(const string &alphabet, const vector<vector<int>> &scores, int unknown)
+        : alphabet(alphabet)
+    {
+        int A = alphabet.size();
+        index.fill(A);
+        for (int i = 0; i < A; i++)
+            index[(unsigned char)alphabet[i]] = i;
+        table.assign((A + 1) * (A + 1), unknown);
+        for (int i = 0; i < A; i++)
+            for (int j = 0; j < A; j++)
+                table[i * (A + 1) + j] = scores[i][j];
+    }
+
+    // +match on the diagonal, mismatch everywhere else
+    static ScoringMatrix simple(const string &alphabet, int match, int mismatch)
+    {
+        int A = alphabet.size();
+        vector<vector<int>> s(A, vector<int>(A, mismatch));
+        for (int i = 0; i < A; i++)
+            s[i][i] = match;
+        return ScoringMatrix(alphabet, s, mismatch);
+    }
+
+    int symbols() const { return alphabet.size() + 1; }
+    int code(char c) const { return index[(unsigned char)c]; }
+    int score(int a, int b) const { return table[a * symbols() + b]; }
+    int maxScore() const { return *max_element(table.begin(), table.end()); }
+    int minScore() const { return *min_element(table.begin(), table.end()); }
+
+private:
+    string alphabet;
+    array<int, 256> index;
+    vector<int> table;
+};
+
+struct LocalAlignment
+{
+    int score = 0;
+    int queryEnd = -1, targetEnd = -1; // last aligned positions (0-based)
+};
+
+/*=====================================================================
+    SCALAR REFERENCE (O(m) memory, one cell at a time)
+======================================================================*/
+LocalAlignment smithWaterman_scalar(const string &query, const string &target, const ScoringMatrix &sm,
+                                    int gapOpen, int gapExtend)
+{
+    int m = query.size();
+    const int NEG = INT_MIN / 4;
+    vector<int> H(m + 1, 0), E(m + 1, NEG);
+    LocalAlignment best;
+
+    for (int j = 0; j < (int)target.size(); j++)
+    {
+        int tc = sm.code(target[j]);
+        int diag = 0, F = NEG;
+        for (int i = 1; i <= m; i++)
+        {
+            E[i] = max(E[i] - gapExtend, H[i] - gapOpen);
+            F = max(F - gapExtend, H[i - 1] - gapOpen); // H[i-1] already this column
+            int h = max({0, diag + sm.score(sm.code(query[i - 1]), tc), E[i], F});
+            diag = H[i];
+            H[i] = h;
+            if (h > best.score)
+                best = {h, i - 1, j};
+        }
+    }
+    return best;
+}
+
+/*=====================================================================
+    STRIPED KERNEL (T = lane type, V = 128-bit vector of T)
+======================================================================*/
+typedef int16_t Vec16x8 __attribute__((vector_size(16)));
+typedef int32_t Vec32x4 __attribute__((vector_size(16)));
+
+template <class T, class V>
+class StripedKernel
+{
+    static const int L = sizeof(V) / sizeof(T);
+
+public:
+    StripedKernel(const string &query, const ScoringMatrix &sm, int gapOpen, int gapExtend)
+        : sm(sm), m(query.size()), segLen((query.size() + L - 1) / L), open(gapOpen), ext(gapExtend)
+    {
+        // profile[c][s] lane l = score(query[s + l * segLen], c); padding rows score 0
+        profile.resize(sm.symbols() * segLen);
+        for (int c = 0; c < sm.symbols(); c++)
+            for (int s = 0; s < segLen; s++)
+                for (int l = 0; l < L; l++)
+                {
+                    int i = s + l * segLen;
+                    profile[c * segLen + s][l] = i < m ? sm.score(sm.code(query[i]), c) : 0;
+                }
+        // every single step (score, open, extend) must stay far from the range limits
+        long long quarter = numeric_limits<T>::max() / 4;
+        fits = max({(long long)sm.maxScore(), -(long long)sm.minScore(), (long long)open, (long long)ext}) <= quarter;
+    }
+
+    // false if the scores came too close to the range of T
+    bool align(const string &target, LocalAlignment &out) const
+    {
+        out = LocalAlignment();
+        if (!fits)
+            return false;
+        if (m == 0)
+            return true;
+        const T NEG = numeric_limits<T>::min() / 2;
+        const long long limit = numeric_limits<T>::max() - max(0, sm.maxScore());
+        vector<V> Hload(segLen, splat(0)), Hstore(segLen, splat(0)), E(segLen, splat(NEG));
+        V vOpen = splat(open), vExt = splat(ext), vZero = splat(0), vNeg = splat(NEG);
+
+        for (int j = 0; j < (int)target.size(); j++)
+        {
+            const V *P = &profile[sm.code(target[j]) * segLen];
+            V vF = vNeg;
+            V vH = shiftIn(Hstore[segLen - 1], 0); // H of row -1 is 0
+            swap(Hload, Hstore);
+            V vMax = vZero;
+
+            for (int s = 0; s < segLen; s++)
+            {
+                vH = vH + P[s];
+                vH = vmax(vH, E[s]);
+                vH = vmax(vH, vF);
+                vH = vmax(vH, vZero);
+                vMax = vmax(vMax, vH);
+                Hstore[s] = vH;
+
+                vH = vH - vOpen;
+                E[s] = vmax(E[s] - vExt, vH);
+                vF = vmax(vF - vExt, vH);
+                vH = Hload[s];
+            }
+
+            // lazy F: carry vertical gaps across lane borders
+            for (int k = 0; k < L; k++)
+            {
+                vF = shiftIn(vF, NEG);
+                bool done = false;
+                for (int s = 0; s < segLen; s++)
+                {
+                    V before = Hstore[s];
+                    V h = vmax(before, vF);
+                    Hstore[s] = h;
+                    vMax = vmax(vMax, h);
+                    E[s] = vmax(E[s], h - vOpen);
+                    // a raised h may also open a new gap (cheaper than
+                    // extending when gapExtend > gapOpen)
+                    vF = vmax(vF - vExt, h - vOpen);
+                    // the first pass already carried before - open to the next row
+                    if (!any(vF > before - vOpen))
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                if (done)
+                    break;
+            }
+
+            T colMax = 0;
+            for (int l = 0; l < L; l++)
+                colMax = max(colMax, vMax[l]);
+            if (colMax > limit)
+                return false;
+            if (colMax > out.score)
+            {
+                out.score = colMax;
+                out.targetEnd = j;
+                out.queryEnd = m;
+                for (int s = 0; s < segLen; s++) // smallest real row with that score
+                    for (int l = 0; l < L; l++)
+                        if (Hstore[s][l] == colMax)
+                            out.queryEnd = min(out.queryEnd, s + l * segLen);
+            }
+        }
+        return true;
+    }
+
+private:
+    ScoringMatrix sm;
+    int m, segLen, open, ext;
+    bool fits;
+    vector<V> profile;
+
+    static V splat(T x)
+    {
+        V v;
+        for (int l = 0; l < L; l++)
+            v[l] = x;
+        return v;
+    }
+
+    static V vmax(V a, V b) { return a > b ? a : b; }
+
+    // move every lane up by one (lane l → l + 1), lane 0 gets `first`
+    static V shiftIn(V v, T first)
+    {
+        V r;
+        r[0] = first;
+        for (int l = 1; l < L; l++)
+            r[l] = v[l - 1];
+        return r;
+    }
+
+    template <class M>
+    static bool any(M mask)
+    {
+        for (int l = 0; l < L; l++)
+            if (mask[l])
+                return true;
+        return false;
+    }
+};
+
+/*=====================================================================
+    ALIGNER: query profile built once, many targets
+======================================================================*/
+class LocalAligner
+{
+public:
+    LocalAligner(const string &query, const ScoringMatrix &sm, int gapOpen, int gapExtend)
+        : query(query), sm(sm), gapOpen(gapOpen), gapExtend(gapExtend),
+          narrow(query, sm, gapOpen, gapExtend) {}
+
+    LocalAlignment align(const string &target)
+    {
+        LocalAlignment res;
+        if (narrow.align(target, res))
+            return res;
+        if (!wide) // 16-bit lanes overflowed → 32-bit lanes
+            wide = make_unique<StripedKernel<int32_t, Vec32x4>>(query, sm, gapOpen, gapExtend);
+        wide->align(target, res);
+        return res;
+    }
+
+private:
+    string query;
+    ScoringMatrix sm;
+    int gapOpen, gapExtend;
+    StripedKernel<int16_t, Vec16x8> narrow;
+    unique_ptr<StripedKernel<int32_t, Vec32x4>> wide;
+};
+
+/*=====================================================================
+    MAIN FUNCTION TO TEST THE SOLUTION
+======================================================================*/
+int main()
+{
+    // DNA: +2 match, -3 mismatch, gap open 5, extend 2
+    ScoringMatrix dna = ScoringMatrix::simple("ACGT", 2, -3);
+    string query = "TTGACACCCTCCCAATT", target = "ACCCCAGGCTTTACACAGACCTCAAGCT";
+    LocalAligner aligner(query, dna, 5, 2);
+    LocalAlignment a = aligner.align(target);
+    cout << "Local alignment score: " << a.score << " (query end " << a.queryEnd
+         << ", target end " << a.targetEnd << ")" << endl;
+    cout << "Scalar reference:      " << smithWaterman_scalar(query, target, dna, 5, 2).score << endl;
+
+    // longest common substring = match 1, anything else ends the run
+    string s1 = "abcde", s2 = "abfce";
+    ScoringMatrix substr = ScoringMatrix::simple("abcdef", 1, -1000);
+    LocalAligner lcsAligner(s1, substr, 1000, 1000);
+    cout << "Longest Common Substring Length (as local alignment): " << lcsAligner.align(s2).score << endl;
+
+    // long identical sequences exceed 16-bit scores → 32-bit fallback
+    string longSeq;
+    for (int i = 0; i < 20000; i++)
+        longSeq += "ACGT"[i * 7 % 4];
+    LocalAligner big(longSeq, dna, 5, 2);
+    cout << "Self-alignment of 20000 bases: " << big.align(longSeq).score << endl;
+
+    // extending a gap costs more than opening one (open 1, extend 4)
+    string q2 = "ACGTTGCAACGTAGCT", t2 = "ACGAACGTTAGCAGCT";
+    LocalAligner oddGaps(q2, dna, 1, 4);
+    cout << "Gap extend > open, striped / scalar: " << oddGaps.align(t2).score << " / "
+         << smithWaterman_scalar(q2, t2, dna, 1, 4).score << endl;
+    return 0;
+}
+
+/*
+| Method                 | Time                 | Space              |
+| ---------------------- | -------------------- | ------------------ |
+| Scalar Gotoh           | O(n * m)             | O(m)               |
+| Striped, L lanes       | O(n * m / L) + lazy F| O(m + |Σ| * m)     |
+| 16 → 32-bit fallback   | at most one rerun    | profile built once |
+*/
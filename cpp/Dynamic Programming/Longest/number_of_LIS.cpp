@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../../fast_io.h"
 using namespace std;
 
 /*
@@ -50,17 +51,20 @@ int number_of_longest_inc_subseq(vector<int>& arr, int n) {
 */
 
 int main() {
+    FastReader in;
+    FastWriter out;
+
     int n;
-    cin >> n;                 // size of array
+    in >> n;                 // size of array
 
     vector<int> arr(n);
     for (int i = 0; i < n; i++) {
-        cin >> arr[i];        // input elements
+        in >> arr[i];        // input elements
     }
 
     int result = number_of_longest_inc_subseq(arr, n);
 
-    cout << result << endl;   // output number of LIS
+    out << result << '\n';   // output number of LIS
 
     return 0;
 }
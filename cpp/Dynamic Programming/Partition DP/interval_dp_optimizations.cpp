@@ -0,0 +1,340 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+----------------------------------------------------
+INTERVAL DP SPEED-UPS: KNUTH, DIVIDE & CONQUER
+----------------------------------------------------
+matrix_chain_mul_tabu, min_cost_to_cut_stick_tabu and
+maxCoins_tabu all have the same shape:
+
+    dp[i][j] = min over split k of
+               dp[i][k] + dp[k+1][j] + cost(i, k, j)
+
+n^2 intervals x n splits = O(n^3). With n = 5000 cuts
+that is ~2 * 10^10 steps (minutes).
+
+Intuition:
+1️⃣ One framework (IntervalDP)
+   - "atoms" 0..n-1, dp[i][i] = 0, join [i..k] + [k+1..j]
+   - stick: atoms = the pieces between cuts
+   - matrix chain: atoms = the matrices
+   - balloons: atoms = the gaps between balloons, the
+     split k means balloon k+1 is burst last
+
+2️⃣ Knuth (Knuth–Yao) → O(n^2)
+   If cost(i, k, j) = w(i, j) does not depend on k and
+   - w satisfies the QUADRANGLE INEQUALITY
+         w(a,c) + w(b,d) <= w(a,d) + w(b,c)   a<=b<=c<=d
+   - w is monotone: a bigger interval never costs less
+   then the best split moves right with the interval:
+         opt[i][j-1] <= opt[i][j] <= opt[i+1][j]
+   Only that window is tried; the windows of one
+   diagonal telescope to O(n) → O(n^2) overall.
+   The stick cost w(i, j) = length of pieces i..j fits
+   (QI with equality).
+
+3️⃣ Checkers
+   - knuthApplies(n, w): the two conditions above, exact
+     for THIS input in O(n^2) (the QI for neighbours
+     i, i+1, j, j+1 implies it for all a<=b<=c<=d)
+   - IntervalDP::optMonotone(): runs the full search and
+     checks the window property on the real opt table.
+     For costs that depend on k (matrix chain, balloons)
+     there is no theorem, so this is the only guide.
+     Random samples find counter examples quickly → those
+     stay O(n^3).
+
+4️⃣ Divide & conquer → O(K n log n)
+   Layered partitions: split a[0..n) into exactly K groups
+       best[g][j] = min_{i<j} best[g-1][i] + C(i, j)
+   If C satisfies the QI, opt[g][j] <= opt[g][j+1]:
+   solve the middle j of a range, then the left half only
+   looks at splits <= its opt and the right half >= it.
+
+5️⃣ Palindrome_Partitioing_II is a 1D partition whose
+   cost is "is a palindrome" (0 / ∞) → no QI. Its O(n^3)
+   comes from re-checking palindromes; expanding around
+   every centre enumerates them all in O(n^2) total.
+----------------------------------------------------
+*/
+
+enum class SplitSearch { All, Knuth };
+
+/*
+----------------------------------------------------
+1) INTERVAL DP (min form)
+----------------------------------------------------
+Tables are triangular (only i <= j is stored):
+n = 5000 → 12.5M cells instead of 25M.
+----------------------------------------------------
+*/
+
+class IntervalDP {
+public:
+    // cost(i, k, j) = price of joining [i..k] and [k+1..j]
+    // Knuth on a cost without the window property gives WRONG answers:
+    // check with knuthApplies / optMonotone first
+    template <class Cost>
+    IntervalDP(int n, Cost cost, SplitSearch search) : n(max(n, 0)), search(search), rowStart(this->n + 1) {
+        for (int i = 0; i < this->n; i++)
+            rowStart[i + 1] = rowStart[i] + (this->n - i);
+        dp.assign(rowStart[this->n], 0);
+        opt.assign(rowStart[this->n], 0);
+
+        for (int i = this->n - 1; i >= 0; i--) {
+            opt[at(i, i)] = i;
+            for (int j = i + 1; j < this->n; j++) {
+                int lo = i, hi = j - 1;
+                if (search == SplitSearch::Knuth) {
+                    lo = opt[at(i, j - 1)];                 // row i, already done
+                    hi = max(lo, min(hi, opt[at(i + 1, j)])); // row below, already done
+                }
+                long long best = LLONG_MAX;
+                int arg = lo;
+                for (int k = lo; k <= hi; k++) {
+                    long long c = dp[at(i, k)] + dp[at(k + 1, j)] + cost(i, k, j);
+                    if (c < best) best = c, arg = k;  // smallest best split
+                }
+                dp[at(i, j)] = best;
+                opt[at(i, j)] = arg;
+            }
+        }
+    }
+
+    // Knuth if the whole-interval weight w(i, j) allows it, full search otherwise
+    template <class W>
+    static IntervalDP fromWeights(int n, W w);
+
+    long long cost() const { return n ? dp[at(0, n - 1)] : 0; }
+    long long value(int i, int j) const { return dp[at(i, j)]; }
+    int split(int i, int j) const { return opt[at(i, j)]; }
+    SplitSearch searchUsed() const { return search; }
+
+    // opt[i][j-1] <= opt[i][j] <= opt[i+1][j] everywhere?
+    bool optMonotone() const {
+        for (int i = 0; i < n; i++)
+            for (int j = i + 2; j < n; j++)
+                if (opt[at(i, j - 1)] > opt[at(i, j)] || opt[at(i, j)] > opt[at(i + 1, j)])
+                    return false;
+        return true;
+    }
+
+private:
+    int n;
+    SplitSearch search;
+    vector<size_t> rowStart;
+    vector<long long> dp;
+    vector<int> opt;
+
+    size_t at(int i, int j) const { return rowStart[i] + (j - i); }
+};
+
+/*
+----------------------------------------------------
+2) CHECKERS (exact for the given input, O(n^2))
+----------------------------------------------------
+*/
+
+// w(a,c) + w(b,d) <= w(a,d) + w(b,c); neighbours are enough:
+// every bigger quadrangle is a sum of neighbour ones
+template <class W>
+bool quadrangleHolds(int n, W w) {
+    for (int i = 0; i + 1 < n; i++)
+        for (int j = i + 1; j + 1 < n; j++)
+            if (w(i, j) + w(i + 1, j + 1) > w(i, j + 1) + w(i + 1, j))
+                return false;
+    return true;
+}
+
+// QI + monotone on inclusion (w(i+1, j) <= w(i, j) >= w(i, j-1))
+template <class W>
+bool knuthApplies(int n, W w) {
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            if (w(i + 1, j) > w(i, j) || w(i, j - 1) > w(i, j))
+                return false;
+    return quadrangleHolds(n, w);
+}
+
+template <class W>
+IntervalDP IntervalDP::fromWeights(int n, W w) {
+    SplitSearch s = knuthApplies(n, w) ? SplitSearch::Knuth : SplitSearch::All;
+    return IntervalDP(n, [&](int i, int, int j) { return w(i, j); }, s);
+}
+
+/*
+----------------------------------------------------
+3) LAYERED PARTITION (exactly K groups)
+----------------------------------------------------
+C(i, j) = cost of the group a[i..j), 0 <= i < j <= n
+Divide & conquer needs C to satisfy the QI (check with
+quadrangleHolds or layeredOptMonotone).
+----------------------------------------------------
+*/
+
+const long long INF_COST = LLONG_MAX / 4;
+
+// Time: O(K * n log n)    Space: O(n)
+template <class C>
+long long layeredPartition(int n, int K, C cost) {
+    if (K <= 0 || K > n) return n == 0 && K == 0 ? 0 : INF_COST;
+    vector<long long> prev(n + 1, INF_COST), cur(n + 1);
+    prev[0] = 0;
+
+    for (int g = 1; g <= K; g++) {
+        fill(cur.begin(), cur.end(), INF_COST);
+        // cur[j] for j in [lo, hi], best split known to lie in [optLo, optHi]
+        function<void(int, int, int, int)> solve = [&](int lo, int hi, int optLo, int optHi) {
+            if (lo > hi) return;
+            int mid = (lo + hi) / 2, arg = optLo;
+            for (int i = optLo; i <= min(mid - 1, optHi); i++) {
+                if (prev[i] >= INF_COST) continue;
+                long long c = prev[i] + cost(i, mid);
+                if (c < cur[mid]) cur[mid] = c, arg = i;
+            }
+            solve(lo, mid - 1, optLo, arg);
+            solve(mid + 1, hi, arg, optHi);
+        };
+        solve(g, n, g - 1, n - 1);  // g groups need >= g items
+        swap(prev, cur);
+    }
+    return prev[n];
+}
+
+// full O(K * n^2) search; is opt[g][j] <= opt[g][j+1] everywhere?
+template <class C>
+bool layeredOptMonotone(int n, int K, C cost) {
+    vector<long long> prev(n + 1, INF_COST), cur(n + 1);
+    prev[0] = 0;
+    for (int g = 1; g <= K; g++) {
+        fill(cur.begin(), cur.end(), INF_COST);
+        int lastOpt = -1;
+        for (int j = g; j <= n; j++) {
+            int arg = -1;
+            for (int i = g - 1; i < j; i++) {
+                if (prev[i] >= INF_COST) continue;
+                long long c = prev[i] + cost(i, j);
+                if (c < cur[j]) cur[j] = c, arg = i;
+            }
+            if (arg < lastOpt) return false;
+            lastOpt = arg;
+        }
+        swap(prev, cur);
+    }
+    return true;
+}
+
+/*
+----------------------------------------------------
+4) THE ORIGINAL PROBLEMS ON THE FRAMEWORK
+----------------------------------------------------
+*/
+
+// same input as min_cost_to_cut_stick_tabu: cuts sorted, with 0 and n added
+long long min_cost_to_cut_stick_knuth(vector<int>& cuts, int c) {
+    // piece t = [cuts[t], cuts[t+1]], pieces i..j have length cuts[j+1] - cuts[i]
+    auto w = [&](int i, int j) { return (long long)cuts[j + 1] - cuts[i]; };
+    return IntervalDP::fromWeights(c + 1, w).cost();
+}
+
+// same input as matrix_chain_mul_tabu: matrix t is arr[t-1] x arr[t]
+long long matrix_chain_mul_interval(vector<int>& arr) {
+    int n = (int)arr.size() - 1;  // atom t = matrix t+1
+    auto cost = [&](int i, int k, int j) { return (long long)arr[i] * arr[k + 1] * arr[j + 1]; };
+    return IntervalDP(n, cost, SplitSearch::All).cost();
+}
+
+// same input as maxCoins_tabu: a[1..n] balloons, a[0] = a[n+1] = 1
+long long maxCoins_interval(vector<int>& a, int n) {
+    // gaps 0..n (gap t between a[t] and a[t+1]); joining gaps [i..k] and
+    // [k+1..j] bursts balloon k+1 last, between a[i] and a[j+1]
+    auto cost = [&](int i, int k, int j) { return -(long long)a[i] * a[k + 1] * a[j + 1]; };
+    return -IntervalDP(n + 1, cost, SplitSearch::All).cost();
+}
+
+// same result as palindrome_partitioning_II_tabu (minimum cuts)
+// Time: O(n^2)    Space: O(n)
+int palindrome_partitioning_II_centers(string& str) {
+    int n = str.size();
+    if (n == 0) return 0;
+    // parts[e] = fewest palindromes covering str[0..e)
+    vector<int> parts(n + 1, INT_MAX);
+    parts[0] = 0;
+    // centre c2 = b + e of palindrome str[b..e]; every palindrome ending
+    // before b has a smaller centre → parts[b] is final when read
+    for (int c2 = 0; c2 <= 2 * (n - 1); c2++) {
+        for (int b = c2 / 2, e = c2 - b; b >= 0 && e < n && str[b] == str[e]; b--, e++)
+            parts[e + 1] = min(parts[e + 1], parts[b] + 1);
+    }
+    return parts[n] - 1;
+}
+
+// split a into exactly K contiguous groups, minimise Σ (group sum)^2
+long long minSumOfSquares(vector<int>& a, int K) {
+    int n = a.size();
+    vector<long long> pre(n + 1, 0);
+    for (int i = 0; i < n; i++) pre[i + 1] = pre[i] + a[i];
+    auto C = [&](int i, int j) { return (pre[j] - pre[i]) * (pre[j] - pre[i]); };
+    return layeredPartition(n, K, C);
+}
+
+/*
+----------------------------------------------------
+MAIN FUNCTION
+----------------------------------------------------
+*/
+
+int main() {
+    vector<int> cuts = {0, 1, 3, 4, 5, 7};  // stick 7, cuts {1,3,4,5}
+    cout << "Min cost to cut stick (Knuth): " << min_cost_to_cut_stick_knuth(cuts, 4) << endl;
+
+    vector<int> dims = {10, 20, 30, 40, 50};
+    cout << "Matrix chain (framework): " << matrix_chain_mul_interval(dims) << endl;
+
+    vector<int> balloons = {1, 3, 1, 5, 8, 1};
+    cout << "Burst balloons (framework): " << maxCoins_interval(balloons, 4) << endl;
+
+    string s = "aab";
+    cout << "Palindrome partitioning II (centres): " << palindrome_partitioning_II_centers(s) << endl;
+
+    // does the Knuth window hold for matrix chain? test random chains
+    mt19937 rng(7);
+    int broken = 0;
+    for (int t = 0; t < 200; t++) {
+        vector<int> d(8);
+        for (int& x : d) x = 1 + rng() % 30;
+        auto cost = [&](int i, int k, int j) { return (long long)d[i] * d[k + 1] * d[j + 1]; };
+        broken += !IntervalDP(7, cost, SplitSearch::All).optMonotone();
+    }
+    cout << "Matrix chain: opt window broken in " << broken << " / 200 random chains"
+         << (broken ? " → keep the full search" : "") << endl;
+
+    vector<int> a = {4, 1, 7, 3, 9, 2, 8, 5};
+    auto C = [&](int i, int j) {
+        long long sum = accumulate(a.begin() + i, a.begin() + j, 0LL);
+        return sum * sum;
+    };
+    cout << "Sum-of-squares cost: opt monotone = " << layeredOptMonotone(a.size(), 3, C)
+         << ", 3 groups (D&C): " << minSumOfSquares(a, 3) << endl;
+
+    // 5000 cuts: O(n^3) would take minutes
+    int L = 1000000, c = 5000;
+    vector<int> big = {0, L};
+    for (int i = 0; i < c; i++) big.push_back(1 + rng() % (L - 1));
+    sort(big.begin(), big.end());
+    cout << "5000 cuts on a stick of 10^6 (Knuth): " << min_cost_to_cut_stick_knuth(big, c) << endl;
+    return 0;
+}
+
+/*
+| Method                        | Time             | Space   |
+| ----------------------------- | ---------------- | ------- |
+| interval DP, full search      | O(n^3)           | O(n^2)  |
+| interval DP, Knuth window     | O(n^2)           | O(n^2)  |
+| knuthApplies / quadrangle     | O(n^2)           | O(1)    |
+| layered, full search          | O(K * n^2)       | O(n)    |
+| layered, divide & conquer     | O(K * n log n)   | O(n)    |
+| palindrome partition, centres | O(n^2)           | O(n)    |
+Triangular tables: n(n+1)/2 cells of 8 + 4 bytes.
+*/
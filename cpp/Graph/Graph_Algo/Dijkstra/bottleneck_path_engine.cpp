@@ -0,0 +1,272 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+====================================================================
+🧠 Problem: Path With Minimum Effort — batches of queries
+====================================================================
+Effort of a path = maximum |height difference| along the path.
+minimumEffort() answers ONE query (top-left → bottom-right) with a
+Dijkstra over vector<vector<int>> and a heap of {effort, {row, col}}.
+
+A terrain service asks MANY (source, target) effort queries on the
+SAME height grid. This engine keeps the grid flat (cell = r * m + c)
+and offers three strategies:
+
+1️⃣ Dijkstra (minimax relaxation) on the flat grid
+   - heap of {effort, cell}, stops as soon as the target pops
+   - best for a single query on a big grid
+
+2️⃣ Kruskal + DSU (offline, all queries at once)
+   - sort the 2*N*M grid edges by weight
+   - union them in that order; the answer of query (s, t) is the
+     weight of the edge whose union first puts s and t together
+     (the bottleneck edge on the minimum spanning tree path)
+   - each DSU root keeps the list of still-open queries touching it;
+     on union the SMALLER list is scanned (small-to-large), so the
+     bookkeeping is O(Q log Q) in total
+   - the sort is paid once for the whole batch
+
+3️⃣ Binary search on the answer + BFS
+   - "can we reach t using only edges with weight <= x?" is monotone
+   - BFS with a plain queue, no heap; great when heights span a
+     small range (few binary-search steps)
+
+Auto compares the estimated work of the three for this grid size,
+height range and query count (see choose()).
+====================================================================
+*/
+
+enum class EffortStrategy { Auto, Dijkstra, KruskalDSU, BinarySearchBFS };
+
+class DisjointSet {
+public:
+    vector<int> parent, size;
+
+    DisjointSet(int n) {
+        parent.resize(n);
+        size.resize(n, 1);
+        for (int i = 0; i < n; i++) parent[i] = i;
+    }
+
+    int findPar(int node) {
+        while (node != parent[node]) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    }
+};
+
+class EffortGrid {
+public:
+    EffortGrid(const vector<int>& heights, int n, int m) : h(heights), n(n), m(m) {}
+
+    // queries: {source cell, target cell}; returns the min effort of each
+    vector<int> solve(const vector<pair<int, int>>& queries,
+                      EffortStrategy strategy = EffortStrategy::Auto) {
+        if (strategy == EffortStrategy::Auto) strategy = choose(queries.size());
+        vector<int> ans;
+        if (strategy == EffortStrategy::KruskalDSU) return kruskalBatch(queries);
+        for (auto& q : queries)
+            ans.push_back(strategy == EffortStrategy::Dijkstra ? dijkstra(q.first, q.second)
+                                                               : binarySearch(q.first, q.second));
+        return ans;
+    }
+
+    // Kruskal keeps 2 edges (16 B), DSU (8 B) and a query list (24 B) per
+    // cell, ~10x a single search: above this many cells it is never used
+    static constexpr long long BATCH_MAX_CELLS = 1LL << 26;   // ~3 GB
+
+    // Estimated work (V = n * m cells, Q queries, H = height range), units
+    // measured on a 1000 x 1000 grid (~10 ns each):
+    //   Dijkstra       Q * (V * log2(V) + 64)              early exit ~ half the grid
+    //   binary search  Q * (1.5 * V * log2(H + 1) + 64)    one BFS per step
+    //                  (+64: set-up, the dist / vis arrays)
+    //   Kruskal + DSU  2V * log2(2V) + Q * log2(Q + 1) + 64   one sort for the batch
+    // On that grid the batch costs about two Dijkstra queries, so a huge
+    // grid with a few queries stays with per-query searches; small height
+    // ranges (few BFS steps) favour the binary search.
+    EffortStrategy choose(size_t queryCount) const {
+        double V = max((double)n * m, 2.0), Q = queryCount;
+        auto mm = minmax_element(h.begin(), h.end());
+        double H = *mm.second - *mm.first;
+
+        double dijkstraCost = Q * (V * log2(V) + 64);
+        double bfsCost = Q * (1.5 * V * log2(H + 1) + 64);
+        double batchCost = 2 * V * log2(2 * V) + Q * log2(Q + 1) + 64;
+
+        EffortStrategy best = bfsCost < dijkstraCost ? EffortStrategy::BinarySearchBFS : EffortStrategy::Dijkstra;
+        double bestCost = min(bfsCost, dijkstraCost);
+        if ((long long)n * m <= BATCH_MAX_CELLS && batchCost < bestCost) best = EffortStrategy::KruskalDSU;
+        return best;
+    }
+
+    // 1️⃣ minimax Dijkstra, early exit at the target
+    int dijkstra(int src, int dst) {
+        vector<int> dist((size_t)n * m, INT_MAX);
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+        dist[src] = 0;
+        pq.push({0, src});
+        while (!pq.empty()) {
+            auto [diff, cell] = pq.top();
+            pq.pop();
+            if (cell == dst) return diff;
+            if (diff > dist[cell]) continue;   // stale entry
+            forEachNeighbor(cell, [&](int nxt) {
+                int newEffort = max(diff, abs(h[cell] - h[nxt]));
+                if (newEffort < dist[nxt]) {
+                    dist[nxt] = newEffort;
+                    pq.push({newEffort, nxt});
+                }
+            });
+        }
+        return -1;
+    }
+
+    // 3️⃣ binary search on the effort, BFS as the feasibility check
+    int binarySearch(int src, int dst) {
+        auto mm = minmax_element(h.begin(), h.end());
+        int lo = 0, hi = *mm.second - *mm.first;
+        vector<char> vis((size_t)n * m);
+        vector<int> q;
+        auto reachable = [&](int limit) {
+            fill(vis.begin(), vis.end(), 0);
+            q.assign(1, src);
+            vis[src] = 1;
+            for (size_t head = 0; head < q.size(); head++) {
+                int cell = q[head];
+                if (cell == dst) return true;
+                forEachNeighbor(cell, [&](int nxt) {
+                    if (!vis[nxt] && abs(h[cell] - h[nxt]) <= limit) {
+                        vis[nxt] = 1;
+                        q.push_back(nxt);
+                    }
+                });
+            }
+            return false;
+        };
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (reachable(mid)) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    }
+
+    // 2️⃣ Kruskal order + DSU, answering the whole batch offline
+    vector<int> kruskalBatch(const vector<pair<int, int>>& queries) {
+        int cells = n * m, Q = queries.size();
+        vector<int> ans(Q, -1);
+
+        // edge id = cell * 2 + dir (0 = right, 1 = down), key = weight << 32 | id
+        vector<uint64_t> edges;
+        edges.reserve(2 * (size_t)cells);
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < m; c++) {
+                int cell = r * m + c;
+                if (c + 1 < m) edges.push_back((uint64_t)abs(h[cell] - h[cell + 1]) << 32 | (uint32_t)(cell * 2));
+                if (r + 1 < n) edges.push_back((uint64_t)abs(h[cell] - h[cell + m]) << 32 | (uint32_t)(cell * 2 + 1));
+            }
+        sort(edges.begin(), edges.end());
+
+        DisjointSet ds(cells);
+        vector<vector<int>> open(cells);   // open query ids per root
+        for (int i = 0; i < Q; i++) {
+            auto [s, t] = queries[i];
+            if (s == t) {
+                ans[i] = 0;
+                continue;
+            }
+            open[s].push_back(i);
+            open[t].push_back(i);
+        }
+        int remaining = count(ans.begin(), ans.end(), -1);
+
+        for (uint64_t key : edges) {
+            if (remaining == 0) break;
+            int w = key >> 32, id = (uint32_t)key;
+            int a = id / 2, b = (id & 1) ? a + m : a + 1;
+            int ra = ds.findPar(a), rb = ds.findPar(b);
+            if (ra == rb) continue;
+            if (ds.size[ra] < ds.size[rb]) swap(ra, rb);   // ra = new root
+            ds.parent[rb] = ra;
+            ds.size[ra] += ds.size[rb];
+
+            // small-to-large over the open query lists
+            if (open[ra].size() < open[rb].size()) swap(open[ra], open[rb]);
+            for (int qi : open[rb]) {
+                if (ans[qi] != -1) continue;
+                auto [s, t] = queries[qi];
+                if (ds.findPar(s) == ra && ds.findPar(t) == ra) {
+                    ans[qi] = w;
+                    remaining--;
+                } else {
+                    open[ra].push_back(qi);
+                }
+            }
+            vector<int>().swap(open[rb]);
+        }
+        return ans;
+    }
+
+private:
+    const vector<int>& h;
+    int n, m;
+
+    template <class F>
+    void forEachNeighbor(int cell, F&& f) const {
+        int r = cell / m, c = cell % m;
+        if (r > 0) f(cell - m);
+        if (c + 1 < m) f(cell + 1);
+        if (r + 1 < n) f(cell + m);
+        if (c > 0) f(cell - 1);
+    }
+};
+
+// Drop-in replacement for minimumEffort(heights)
+int minimumEffort_flat(vector<vector<int>>& heights) {
+    int n = heights.size(), m = heights[0].size();
+    vector<int> flat;
+    for (auto& row : heights) flat.insert(flat.end(), row.begin(), row.end());
+    EffortGrid grid(flat, n, m);
+    return grid.solve({{0, n * m - 1}})[0];
+}
+
+int main() {
+    vector<vector<int>> heights = {
+        {1, 2, 2},
+        {3, 8, 2},
+        {5, 3, 5}
+    };
+    cout << "Minimum effort (top-left -> bottom-right): " << minimumEffort_flat(heights) << endl;
+
+    int n = 3, m = 3;
+    vector<int> flat = {1, 2, 2, 3, 8, 2, 5, 3, 5};
+    EffortGrid grid(flat, n, m);
+    vector<pair<int, int>> queries = {{0, 8}, {0, 4}, {6, 2}, {3, 3}};
+    const char* names[] = {"Dijkstra", "Kruskal + DSU", "Binary search + BFS"};
+    EffortStrategy modes[] = {EffortStrategy::Dijkstra, EffortStrategy::KruskalDSU,
+                              EffortStrategy::BinarySearchBFS};
+    for (int k = 0; k < 3; k++) {
+        cout << names[k] << ":";
+        for (int e : grid.solve(queries, modes[k])) cout << " " << e;
+        cout << endl;
+    }
+    return 0;
+}
+
+/*
+====================================================================
+📊 Time Complexity (N*M cells, Q queries, H = height range):
+--------------------------------------------------------------------
+- Dijkstra        : O(N*M log(N*M)) per query
+- Kruskal + DSU   : O(N*M log(N*M) + Q log Q) for the whole batch
+- Binary search   : O(N*M log H) per query
+
+💾 Space Complexity:
+--------------------------------------------------------------------
+- Flat grid + dist / vis: O(N*M)
+- DSU + query lists     : O(N*M + Q)
+====================================================================
+*/
@@ -0,0 +1,202 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+------------------------------------------------------------
+🧠 Problem: Minimum Multiplications — thousands of queries
+------------------------------------------------------------
+Same rules as minmum_Multiplications_to_reach_End.cpp: from x we may
+go to (x * a) % MOD for any a in arr, each step costs 1.
+
+minimumMultiplications(arr, start, end) runs a fresh BFS over all
+MOD residues for every query. When the multiplier set is fixed and
+only (start, end) change, almost all of that work is repeated.
+
+------------------------------------------------------------
+🧩 Approach: precomputed distance tables
+------------------------------------------------------------
+1️⃣ Normalise the multipliers once: reduce mod MOD and drop
+   duplicates (they generate identical edges).
+2️⃣ For a start s, ONE BFS gives dist[s][v] for every residue v.
+   The table is cached, so every later (s, end) is an O(1) lookup.
+   A table is MOD ints (400 KB for MOD = 1e5), so the cache keeps at
+   most maxTables of them and evicts the least recently used one;
+   clear() drops them all.
+   - visited is a bitset (MOD bits instead of MOD ints)
+   - the queue is a flat vector<int> processed level by level
+3️⃣ Batches of starts are solved together, 64 at a time:
+   reach[v] / front[v] are 64-bit masks, bit i = "start i".
+   One sweep over the residues per BFS level advances all 64
+   searches at once:
+       next[(u * a) % MOD] |= front[u]   (for every a)
+       newly = next[v] & ~reach[v]  → those starts reach v now
+------------------------------------------------------------
+*/
+
+class MultiplicationBFS {
+public:
+    MultiplicationBFS(const vector<int>& arr, int mod = 100000, size_t maxTables = 64)
+        : mod(mod), maxTables(max<size_t>(maxTables, 1)) {
+        for (int a : arr) mults.push_back(((long long)a % mod + mod) % mod);
+        sort(mults.begin(), mults.end());
+        mults.erase(unique(mults.begin(), mults.end()), mults.end());
+    }
+
+    // Minimum multiplications from start to end, -1 if unreachable
+    // or if start / end is not a residue in [0, MOD)
+    int query(int start, int end) {
+        if (!valid(start) || !valid(end)) return -1;
+        return table(start)[end];
+    }
+
+    // Full distance table from start (empty if start is out of range).
+    // The reference stays valid until the next call that may evict it.
+    const vector<int>& table(int start) {
+        static const vector<int> none;
+        if (!valid(start)) return none;
+        auto it = cache.find(start);
+        if (it != cache.end()) {
+            lru.splice(lru.begin(), lru, it->second.second);
+            return it->second.first;
+        }
+        return store(start, bfs(start));
+    }
+
+    // Precompute tables for many starts, 64 per bit-parallel sweep.
+    // Out-of-range starts are ignored; at most maxTables are kept.
+    void precompute(vector<int> starts) {
+        sort(starts.begin(), starts.end());
+        starts.erase(unique(starts.begin(), starts.end()), starts.end());
+        vector<int> todo;
+        for (int s : starts)
+            if (valid(s) && !cache.count(s) && todo.size() < maxTables) todo.push_back(s);
+        for (size_t i = 0; i < todo.size(); i += 64)
+            batchBfs(vector<int>(todo.begin() + i, todo.begin() + min(todo.size(), i + 64)));
+    }
+
+    // Drop every cached table
+    void clear() {
+        cache.clear();
+        lru.clear();
+    }
+
+    size_t cachedTables() const { return cache.size(); }
+
+private:
+    int mod;
+    size_t maxTables;
+    vector<int> mults;
+    list<int> lru;   // cached starts, most recently used first
+    unordered_map<int, pair<vector<int>, list<int>::iterator>> cache;
+
+    bool valid(int x) const { return x >= 0 && x < mod; }
+
+    const vector<int>& store(int start, vector<int> dist) {
+        if (cache.size() >= maxTables) {
+            cache.erase(lru.back());
+            lru.pop_back();
+        }
+        lru.push_front(start);
+        auto& entry = cache[start];
+        entry = {move(dist), lru.begin()};
+        return entry.first;
+    }
+
+    vector<int> bfs(int start) {
+        vector<int> dist(mod, -1);
+        vector<uint64_t> visited((mod + 63) / 64, 0);
+        auto visit = [&](int x) {
+            uint64_t bit = 1ULL << (x & 63);
+            if (visited[x >> 6] & bit) return false;
+            visited[x >> 6] |= bit;
+            return true;
+        };
+
+        vector<int> q = {start};
+        visit(start);
+        dist[start] = 0;
+        for (size_t head = 0; head < q.size(); head++) {
+            int node = q[head];
+            for (int a : mults) {
+                int num = (1LL * a * node) % mod;
+                if (visit(num)) {
+                    dist[num] = dist[node] + 1;
+                    q.push_back(num);
+                }
+            }
+        }
+        return dist;
+    }
+
+    void batchBfs(const vector<int>& starts) {
+        int k = starts.size();
+        vector<vector<int>> dist(k, vector<int>(mod, -1));
+        vector<uint64_t> reach(mod, 0), front(mod, 0), next(mod, 0);
+        vector<int> active, nextActive;   // residues with a non-empty frontier mask
+
+        for (int i = 0; i < k; i++) {
+            int s = starts[i];
+            if (!front[s]) active.push_back(s);
+            front[s] |= 1ULL << i;
+            reach[s] |= 1ULL << i;
+            dist[i][s] = 0;
+        }
+
+        for (int level = 1; !active.empty(); level++) {
+            nextActive.clear();
+            for (int u : active) {
+                uint64_t f = front[u];
+                for (int a : mults) {
+                    int v = (1LL * a * u) % mod;
+                    uint64_t add = f & ~reach[v] & ~next[v];
+                    if (!add) continue;
+                    if (!next[v]) nextActive.push_back(v);
+                    next[v] |= add;
+                }
+                front[u] = 0;
+            }
+            for (int v : nextActive) {
+                uint64_t newly = next[v];
+                reach[v] |= newly;
+                front[v] = newly;
+                next[v] = 0;
+                for (; newly; newly &= newly - 1)
+                    dist[__builtin_ctzll(newly)][v] = level;
+            }
+            swap(active, nextActive);
+        }
+
+        for (int i = 0; i < k; i++) store(starts[i], move(dist[i]));
+    }
+};
+
+// Drop-in replacement for Solution::minimumMultiplications
+int minimumMultiplications_table(vector<int>& arr, int start, int end) {
+    MultiplicationBFS engine(arr);
+    return engine.query(start, end);
+}
+
+int main() {
+    vector<int> arr = {2, 5, 7};
+    cout << "Minimum multiplications 3 -> 30: " << minimumMultiplications_table(arr, 3, 30) << endl;
+
+    MultiplicationBFS engine({3, 4, 65});
+    engine.precompute({7, 10, 123});   // one bit-parallel BFS for all three starts
+    vector<pair<int, int>> queries = {{7, 66175}, {10, 40}, {123, 123}, {7, 1}, {-5, 40}, {7, 100000}};
+    for (auto [s, e] : queries)
+        cout << "Minimum multiplications " << s << " -> " << e << ": " << engine.query(s, e) << endl;
+    return 0;
+}
+
+/*
+------------------------------------------------------------
+📊 Time Complexity:
+- First query from a start: O(MOD * |arr|), later ones O(1)
+- Batch of up to 64 starts: a residue is expanded once per distinct
+  level at which some start reaches it, so O(MOD * |arr|) word
+  operations per such level - usually far less than 64 separate BFS
+💾 Space Complexity:
+- O(MOD) ints per cached start table, at most maxTables tables
+- Bitset visited: MOD / 8 bytes; batch masks: 3 * MOD words
+------------------------------------------------------------
+*/
@@ -0,0 +1,244 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+------------------------------------------------------------
+🧠 Problem: Resource-Constrained Shortest Path
+            (Cheapest Flights with several limits at once)
+------------------------------------------------------------
+CheapestFlight() only knows one limit (at most K stops) and pushes
+{stops, {node, cost}} into a queue, re-expanding a node every time a
+cheaper cost shows up even if that state is useless.
+
+Here every flight u -> v carries:
+   cost     : what we minimise (fare)
+   resource : something with a total budget (e.g. loyalty points, CO2)
+   duration : travel time
+and a search can combine:
+   - a hop limit           (K stops  ==  K + 1 flights)
+   - a budget              (Σ resource <= budget)
+   - time windows per city (arrive by latest[v]; if early, wait until
+                            earliest[v])
+
+------------------------------------------------------------
+🧩 Approach 1: Label-setting with Pareto-front dominance
+------------------------------------------------------------
+A LABEL is one partial route: (node, cost, hops, resource, time).
+Label A dominates label B at the same node if A is no worse in every
+field: cost, hops, resource and arrival time (arriving earlier never
+hurts because we are allowed to wait).
+
+1️⃣ Min-heap of labels ordered by cost.
+2️⃣ Pop the cheapest label. If some settled label of that node dominates
+   it → discard. Otherwise it joins the node's Pareto front.
+3️⃣ The first settled label of dst is optimal (costs are >= 0).
+4️⃣ Extend along every out-edge; drop the new label right away if it
+   breaks a constraint or is dominated by the target's front.
+Labels keep a parent index, so the route is rebuilt at the end.
+
+------------------------------------------------------------
+🧩 Approach 2: Bellman-Ford by rounds (hop limit only)
+------------------------------------------------------------
+Round i holds the cheapest cost using at most i flights:
+   cur[v] = min(cur[v], prev[u] + w)   for every edge (u, v, w)
+over flat edge arrays (no adjacency list, no queue). Stops early once
+a round changes nothing, so a large K costs no more than needed.
+------------------------------------------------------------
+*/
+
+/*
+------------------------------------------------------------
+Graph stored as CSR (head offsets + flat edge arrays)
+------------------------------------------------------------
+*/
+struct FlightEdge {
+    int u, v;
+    long long cost, resource, duration;
+};
+
+class FlightGraph {
+public:
+    int n;
+    vector<int> head, to;
+    vector<long long> cost, resource, duration;
+
+    FlightGraph(int n, const vector<FlightEdge>& edges) : n(n), head(n + 1, 0) {
+        for (auto& e : edges) head[e.u + 1]++;
+        for (int i = 0; i < n; i++) head[i + 1] += head[i];
+        int E = edges.size();
+        to.resize(E), cost.resize(E), resource.resize(E), duration.resize(E);
+        vector<int> pos(head.begin(), head.end() - 1);
+        for (auto& e : edges) {
+            int k = pos[e.u]++;
+            to[k] = e.v, cost[k] = e.cost, resource[k] = e.resource, duration[k] = e.duration;
+        }
+    }
+};
+
+struct Constraints {
+    int maxHops = INT_MAX;                      // number of flights
+    long long budget = LLONG_MAX;               // limit on Σ resource
+    vector<pair<long long, long long>> window;  // {earliest, latest} per node, empty = none
+};
+
+struct RouteResult {
+    long long cost = -1;    // -1 if no feasible route
+    vector<int> path;       // src ... dst
+};
+
+/*
+------------------------------------------------------------
+Label-setting search
+------------------------------------------------------------
+*/
+RouteResult constrainedShortestPath(const FlightGraph& g, int src, int dst, const Constraints& lim) {
+    struct Label {
+        int node, hops, parent;
+        long long cost, resource, time;
+    };
+    vector<Label> pool;                 // every label ever created
+    vector<vector<int>> front(g.n);     // settled, non-dominated labels per node
+
+    auto dominates = [&](const Label& a, const Label& b) {
+        return a.cost <= b.cost && a.hops <= b.hops &&
+               a.resource <= b.resource && a.time <= b.time;
+    };
+    auto dominatedAt = [&](int node, const Label& l) {
+        for (int id : front[node])
+            if (dominates(pool[id], l)) return true;
+        return false;
+    };
+
+    long long start = lim.window.empty() ? 0 : lim.window[src].first;
+    pool.push_back({src, 0, -1, 0, 0, start});
+
+    // {cost, hops, label id}
+    priority_queue<tuple<long long, int, int>, vector<tuple<long long, int, int>>, greater<>> pq;
+    pq.push({0, 0, 0});
+
+    while (!pq.empty()) {
+        int id = get<2>(pq.top());
+        pq.pop();
+        Label cur = pool[id];
+        if (dominatedAt(cur.node, cur)) continue;   // re-check: front may have grown
+        front[cur.node].push_back(id);
+
+        if (cur.node == dst) {
+            RouteResult res;
+            res.cost = cur.cost;
+            for (int x = id; x != -1; x = pool[x].parent) res.path.push_back(pool[x].node);
+            reverse(res.path.begin(), res.path.end());
+            return res;
+        }
+        if (cur.hops >= lim.maxHops) continue;
+
+        for (int k = g.head[cur.node]; k < g.head[cur.node + 1]; k++) {
+            int v = g.to[k];
+            Label nxt{v, cur.hops + 1, id, cur.cost + g.cost[k],
+                      cur.resource + g.resource[k], cur.time + g.duration[k]};
+            if (nxt.resource > lim.budget) continue;
+            if (!lim.window.empty()) {
+                if (nxt.time > lim.window[v].second) continue;
+                nxt.time = max(nxt.time, lim.window[v].first);   // wait
+            }
+            if (dominatedAt(v, nxt)) continue;
+            pool.push_back(nxt);
+            pq.push({nxt.cost, nxt.hops, (int)pool.size() - 1});
+        }
+    }
+    return {};
+}
+
+/*
+------------------------------------------------------------
+Bellman-Ford by rounds over flat edge arrays (hop limit only)
+------------------------------------------------------------
+*/
+long long cheapestWithinHops(int n, const vector<FlightEdge>& edges, int src, int dst, int maxHops) {
+    const long long INF = LLONG_MAX / 4;
+    int E = edges.size();
+    vector<int> eu(E), ev(E);
+    vector<long long> ew(E);
+    for (int i = 0; i < E; i++) eu[i] = edges[i].u, ev[i] = edges[i].v, ew[i] = edges[i].cost;
+
+    vector<long long> prev(n, INF), cur;
+    prev[src] = 0;
+    for (int round = 0; round < maxHops; round++) {
+        cur = prev;
+        bool changed = false;
+        for (int i = 0; i < E; i++) {
+            if (prev[eu[i]] == INF) continue;
+            long long cand = prev[eu[i]] + ew[i];
+            if (cand < cur[ev[i]]) {
+                cur[ev[i]] = cand;
+                changed = true;
+            }
+        }
+        swap(prev, cur);
+        if (!changed) break;   // nothing improves with more hops
+    }
+    return prev[dst] == INF ? -1 : prev[dst];
+}
+
+// Drop-in replacements for CheapestFlight(n, flights, src, dst, K)
+int CheapestFlight_rcsp(int n, vector<vector<int>>& flights, int src, int dst, int K) {
+    vector<FlightEdge> edges;
+    for (auto& f : flights) edges.push_back({f[0], f[1], f[2], 0, 0});
+    Constraints lim;
+    lim.maxHops = K + 1;
+    return constrainedShortestPath(FlightGraph(n, edges), src, dst, lim).cost;
+}
+
+int CheapestFlight_rounds(int n, vector<vector<int>>& flights, int src, int dst, int K) {
+    vector<FlightEdge> edges;
+    for (auto& f : flights) edges.push_back({f[0], f[1], f[2], 0, 0});
+    return cheapestWithinHops(n, edges, src, dst, K + 1);
+}
+
+int main() {
+    int n = 4;
+    vector<vector<int>> flights = {
+        {0, 1, 100},
+        {1, 2, 100},
+        {2, 0, 100},
+        {1, 3, 600},
+        {2, 3, 200}
+    };
+    int src = 0, dst = 3, K = 1;
+
+    cout << "Cheapest price (label-setting): " << CheapestFlight_rcsp(n, flights, src, dst, K) << endl;
+    cout << "Cheapest price (Bellman-Ford rounds): " << CheapestFlight_rounds(n, flights, src, dst, K) << endl;
+
+    // Several constraints at once: {u, v, cost, resource, duration}
+    vector<FlightEdge> edges = {
+        {0, 1, 100, 5, 2},
+        {1, 3, 100, 5, 2},
+        {0, 2, 150, 1, 1},
+        {2, 3, 150, 1, 1},
+        {0, 3, 500, 1, 5}
+    };
+    FlightGraph g(4, edges);
+    Constraints lim;
+    lim.maxHops = 2;
+    lim.budget = 6;                                  // route 0-1-3 uses 10
+    lim.window = {{0, 100}, {0, 100}, {0, 100}, {0, 4}};
+    RouteResult best = constrainedShortestPath(g, 0, 3, lim);
+    cout << "Cheapest price with hops <= 2, budget <= 6, arrive by 4: " << best.cost << " via";
+    for (int v : best.path) cout << " " << v;
+    cout << endl;
+    return 0;
+}
+
+/*
+------------------------------------------------------------
+📊 Time Complexity:
+- Label-setting: O(L log L + L * F) where L = labels created and
+  F = Pareto-front size per node. With only a hop limit F <= K + 1,
+  and dominated labels are never expanded.
+- Bellman-Ford rounds: O(min(K, rounds until stable) * E)
+------------------------------------------------------------
+💾 Space Complexity:
+- CSR graph: O(V + E)
+- Labels: O(L); rounds: O(V)
+------------------------------------------------------------
+*/
@@ -0,0 +1,289 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+------------------------------------------------------------
+🧠 Shortest-Path DAG: counting, enumeration, betweenness
+------------------------------------------------------------
+Number_of_ways_to_arrive_at_dest.cpp runs Dijkstra from node 0 and
+counts shortest paths to n-1 modulo 1e9+7 on the fly. Everything else
+about the shortest paths (which edges they use, the paths themselves,
+how central a node is) needs another run per question, and centrality
+over the whole graph means V separate runs.
+
+Key observation (positive edge weights):
+   edge u -> v (weight w) lies on some shortest path from src
+   ⇔  dist[u] + w == dist[v]
+Those edges form a DAG, and Dijkstra's settle order is a topological
+order of it. So after ONE Dijkstra we can:
+
+1️⃣ Count paths     : sigma[src] = 1, then in settle order
+                      sigma[v] += sigma[u] over DAG edges u -> v
+                      (exact 64-bit with overflow detection, or mod p)
+2️⃣ Enumerate paths : walk DAG edges backwards from the target
+3️⃣ Edge dependency : in REVERSE settle order (Brandes)
+                      c(u,v)   = sigma[u] / sigma[v] * (1 + delta[v])
+                      delta[u] += c(u,v)
+                      c(u,v) is how much of the shortest-path traffic
+                      from src goes through edge (u, v).
+
+Betweenness centrality = Σ over all sources of delta[v]. Sources are
+independent, so they are spread over threads; each worker owns its
+dist / sigma / delta / heap buffers and a private accumulator, and the
+accumulators are summed at the end.
+------------------------------------------------------------
+*/
+
+/*
+------------------------------------------------------------
+CSR graph with forward and reverse edges
+------------------------------------------------------------
+*/
+class WeightedGraph {
+public:
+    int n;
+    bool directed;
+    vector<int> head, to, eid;        // forward CSR, eid = original edge index
+    vector<int> rhead, rto;           // reverse CSR (incoming edges)
+    vector<long long> wt, rwt;
+
+    // edges: {u, v, w}; undirected edges are stored both ways with the same eid
+    WeightedGraph(int n, const vector<vector<int>>& edges, bool directed)
+        : n(n), directed(directed) {
+        vector<array<long long, 4>> arcs;   // u, v, w, eid
+        for (int i = 0; i < (int)edges.size(); i++) {
+            arcs.push_back({edges[i][0], edges[i][1], edges[i][2], i});
+            if (!directed) arcs.push_back({edges[i][1], edges[i][0], edges[i][2], i});
+        }
+        build(arcs, head, to, wt, &eid, false);
+        build(arcs, rhead, rto, rwt, nullptr, true);
+    }
+
+private:
+    void build(const vector<array<long long, 4>>& arcs, vector<int>& h, vector<int>& t,
+               vector<long long>& w, vector<int>* ids, bool reverse) {
+        h.assign(n + 1, 0);
+        for (auto& a : arcs) h[(reverse ? a[1] : a[0]) + 1]++;
+        for (int i = 0; i < n; i++) h[i + 1] += h[i];
+        t.resize(arcs.size()), w.resize(arcs.size());
+        if (ids) ids->resize(arcs.size());
+        vector<int> pos(h.begin(), h.end() - 1);
+        for (auto& a : arcs) {
+            int k = pos[reverse ? a[1] : a[0]]++;
+            t[k] = reverse ? a[0] : a[1];
+            w[k] = a[2];
+            if (ids) (*ids)[k] = a[3];
+        }
+    }
+};
+
+/*
+------------------------------------------------------------
+Reusable per-source buffers (one set per worker thread)
+------------------------------------------------------------
+*/
+struct DijkstraWorkspace {
+    vector<long long> dist;
+    vector<double> sigma, delta;
+    vector<int> order;
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>,
+                   greater<pair<long long, int>>> pq;
+
+    // Dijkstra from src; fills dist, order (settle order) and sigma
+    void run(const WeightedGraph& g, int src) {
+        dist.assign(g.n, LLONG_MAX);
+        sigma.assign(g.n, 0.0);
+        order.clear();
+        dist[src] = 0;
+        sigma[src] = 1;
+        pq.push({0, src});
+        while (!pq.empty()) {
+            auto [dis, node] = pq.top();
+            pq.pop();
+            if (dis > dist[node]) continue;   // outdated entry
+            order.push_back(node);
+            for (int k = g.head[node]; k < g.head[node + 1]; k++) {
+                int adjNode = g.to[k];
+                long long nd = dis + g.wt[k];
+                if (nd < dist[adjNode]) {
+                    dist[adjNode] = nd;
+                    sigma[adjNode] = sigma[node];
+                    pq.push({nd, adjNode});
+                } else if (nd == dist[adjNode]) {
+                    sigma[adjNode] += sigma[node];
+                }
+            }
+        }
+    }
+
+    // Brandes back-propagation; calls onEdge(edgeId, contribution)
+    template <class OnEdge>
+    void accumulate(const WeightedGraph& g, OnEdge onEdge) {
+        delta.assign(g.n, 0.0);
+        for (int i = (int)order.size() - 1; i >= 0; i--) {
+            int u = order[i];
+            for (int k = g.head[u]; k < g.head[u + 1]; k++) {
+                int v = g.to[k];
+                if (dist[u] + g.wt[k] != dist[v]) continue;   // not a DAG edge
+                double c = sigma[u] / sigma[v] * (1 + delta[v]);
+                delta[u] += c;
+                onEdge(g.eid[k], c);
+            }
+        }
+    }
+};
+
+class ShortestPathDAG {
+public:
+    ShortestPathDAG(const WeightedGraph& g, int src) : g(g), src(src) { ws.run(g, src); }
+
+    long long distance(int t) const { return ws.dist[t] == LLONG_MAX ? -1 : ws.dist[t]; }
+
+    // Number of shortest paths modulo mod
+    long long countPathsMod(int t, long long mod) const {
+        vector<long long> ways(g.n, 0);
+        ways[src] = 1 % mod;
+        forEachDagEdgeInOrder([&](int u, int v) { ways[v] = (ways[v] + ways[u]) % mod; });
+        return ways[t];
+    }
+
+    // Exact number of shortest paths; false if it does not fit in 64 bits
+    bool countPathsExact(int t, uint64_t& result) const {
+        vector<uint64_t> ways(g.n, 0);
+        vector<char> overflow(g.n, 0);
+        ways[src] = 1;
+        forEachDagEdgeInOrder([&](int u, int v) {
+            overflow[v] |= overflow[u] || __builtin_add_overflow(ways[v], ways[u], &ways[v]);
+        });
+        result = ways[t];
+        return !overflow[t];
+    }
+
+    // All shortest paths src -> t (stops after `limit` paths)
+    vector<vector<int>> enumeratePaths(int t, size_t limit = SIZE_MAX) const {
+        vector<vector<int>> paths;
+        if (ws.dist[t] == LLONG_MAX) return paths;
+        vector<int> path = {t};
+        backtrack(t, path, paths, limit);
+        return paths;
+    }
+
+    // Per-edge dependency from this source (indexed by input edge id)
+    vector<double> edgeDependencies() {
+        vector<double> dep(g.directed ? g.to.size() : g.to.size() / 2, 0.0);
+        ws.accumulate(g, [&](int e, double c) { dep[e] += c; });
+        return dep;
+    }
+
+private:
+    const WeightedGraph& g;
+    int src;
+    DijkstraWorkspace ws;
+
+    template <class F>
+    void forEachDagEdgeInOrder(F f) const {
+        for (int u : ws.order)
+            for (int k = g.head[u]; k < g.head[u + 1]; k++)
+                if (ws.dist[u] + g.wt[k] == ws.dist[g.to[k]]) f(u, g.to[k]);
+    }
+
+    void backtrack(int v, vector<int>& path, vector<vector<int>>& paths, size_t limit) const {
+        if (paths.size() >= limit) return;
+        if (v == src) {
+            paths.emplace_back(path.rbegin(), path.rend());
+            return;
+        }
+        for (int k = g.rhead[v]; k < g.rhead[v + 1]; k++) {
+            int u = g.rto[k];
+            if (ws.dist[u] != LLONG_MAX && ws.dist[u] + g.rwt[k] == ws.dist[v]) {
+                path.push_back(u);
+                backtrack(u, path, paths, limit);
+                path.pop_back();
+            }
+        }
+    }
+};
+
+/*
+------------------------------------------------------------
+Multi-source Brandes betweenness (node and edge), parallel
+------------------------------------------------------------
+*/
+void betweennessCentrality(const WeightedGraph& g, vector<double>& nodeBC, vector<double>& edgeBC,
+                           int threads = max(1u, thread::hardware_concurrency())) {
+    int E = g.directed ? g.to.size() : g.to.size() / 2;
+    threads = max(1, min(threads, g.n));
+    vector<vector<double>> nodeAcc(threads, vector<double>(g.n, 0.0));
+    vector<vector<double>> edgeAcc(threads, vector<double>(E, 0.0));
+    atomic<int> nextSource(0);
+
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            DijkstraWorkspace ws;
+            for (int s; (s = nextSource++) < g.n;) {
+                ws.run(g, s);
+                ws.accumulate(g, [&](int e, double c) { edgeAcc[t][e] += c; });
+                for (int v : ws.order)
+                    if (v != s) nodeAcc[t][v] += ws.delta[v];
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    nodeBC.assign(g.n, 0.0);
+    edgeBC.assign(E, 0.0);
+    for (int t = 0; t < threads; t++) {
+        for (int v = 0; v < g.n; v++) nodeBC[v] += nodeAcc[t][v];
+        for (int e = 0; e < E; e++) edgeBC[e] += edgeAcc[t][e];
+    }
+    if (!g.directed) {   // every pair was counted from both ends
+        for (auto& x : nodeBC) x /= 2;
+        for (auto& x : edgeBC) x /= 2;
+    }
+}
+
+// Same answer as Solution::countPaths(n, roads)
+int countPaths_dag(int n, vector<vector<int>>& roads) {
+    WeightedGraph g(n, roads, false);
+    ShortestPathDAG dag(g, 0);
+    return dag.countPathsMod(n - 1, 1e9 + 7);
+}
+
+int main() {
+    int n = 7;
+    vector<vector<int>> roads = {
+        {0, 6, 7}, {0, 1, 2}, {1, 2, 3}, {1, 3, 3}, {6, 3, 3},
+        {3, 5, 1}, {6, 5, 1}, {2, 5, 1}, {0, 4, 5}, {4, 6, 2}
+    };
+    cout << "Number of ways to arrive at destination: " << countPaths_dag(n, roads) << endl;
+
+    WeightedGraph g(n, roads, false);
+    ShortestPathDAG dag(g, 0);
+    uint64_t exact;
+    if (dag.countPathsExact(6, exact)) cout << "Exact count: " << exact << endl;
+    cout << "Shortest distance: " << dag.distance(6) << endl;
+    cout << "All shortest paths 0 -> 6:" << endl;
+    for (auto& p : dag.enumeratePaths(6)) {
+        for (int i = 0; i < (int)p.size(); i++) cout << p[i] << (i + 1 < (int)p.size() ? " -> " : "\n");
+    }
+
+    vector<double> nodeBC, edgeBC;
+    betweennessCentrality(g, nodeBC, edgeBC);
+    cout << "Betweenness centrality:";
+    for (int v = 0; v < n; v++) cout << " " << v << ":" << nodeBC[v];
+    cout << endl;
+    return 0;
+}
+
+/*
+------------------------------------------------------------
+📊 Time Complexity:
+- One source (count / dependencies): O((V + E) log V)
+- Enumeration: O(P * L) for P paths of length L
+- Betweenness: O(V * (V + E) log V) / threads
+💾 Space Complexity:
+- CSR graph: O(V + E)
+- Per worker: O(V) buffers + O(V + E) accumulators
+------------------------------------------------------------
+*/
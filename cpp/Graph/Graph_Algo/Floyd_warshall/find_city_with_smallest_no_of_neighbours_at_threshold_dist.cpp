@@ -123,6 +123,107 @@ int findCity_dijkstra(int n, int m, vector<vector<int>>& edges, int distanceThre
     return cityNo;
 }
 
+/*
+Intuition (parallel, threshold-limited Dijkstra):
+------------
+findCity_dijkstra runs V independent Dijkstras one after another, and
+each of them explores the WHOLE graph even though only distances
+<= distanceThreshold matter.
+
+1️⃣ Sources are independent → spread them over a pool of worker
+   threads. Workers grab blocks of sources from a shared atomic
+   counter, so a slow region of the graph does not stall the others.
+2️⃣ Each worker owns its buffers (dist, heap, list of touched nodes)
+   and reuses them for every source. Only the touched entries are
+   reset afterwards, so a run costs O(size of its neighbourhood),
+   not O(V).
+3️⃣ Early termination: a node is never pushed with a distance above
+   the threshold. The search stops at the threshold ball around src,
+   which on a large sparse graph is a tiny local region.
+4️⃣ Counting happens during the search: each node settled is a city
+   within reach, so no O(V) scan over dist is needed.
+
+Time Complexity:  O(Σ over sources of E_ball log E_ball) / threads
+                  ≤ O(V * E log V) / threads
+Space Complexity: O(V + E) graph + O(V) buffers per worker
+*/
+
+struct ThresholdDijkstra {
+    vector<int> dist, touched;
+    vector<pair<int, int>> heap;   // min-heap of {dist, node}
+
+    // cities within threshold of src (src included), CSR adjacency
+    int run(const vector<int>& head, const vector<pair<int, int>>& arcs, int src, int threshold) {
+        if (dist.empty()) dist.assign(head.size() - 1, INT_MAX);
+        auto push = [&](int d, int node) {
+            if (dist[node] == INT_MAX) touched.push_back(node);
+            dist[node] = d;
+            heap.push_back({d, node});
+            push_heap(heap.begin(), heap.end(), greater<pair<int, int>>());
+        };
+
+        int cnt = 0;
+        push(0, src);
+        while (!heap.empty()) {
+            pop_heap(heap.begin(), heap.end(), greater<pair<int, int>>());
+            auto [d, node] = heap.back();
+            heap.pop_back();
+            if (d > dist[node]) continue;   // outdated entry
+            cnt++;
+            for (int k = head[node]; k < head[node + 1]; k++) {
+                auto [nbr, wt] = arcs[k];
+                long long nd = (long long)d + wt;
+                if (nd <= threshold && nd < dist[nbr]) push(nd, nbr);
+            }
+        }
+
+        for (int x : touched) dist[x] = INT_MAX;
+        touched.clear();
+        return cnt;
+    }
+};
+
+int findCity_parallelDijkstra(int n, int /*m*/, vector<vector<int>>& edges, int distanceThreshold,
+                              int threads = max(1u, thread::hardware_concurrency())) {
+    // Step 1: CSR adjacency (undirected → both directions)
+    vector<int> head(n + 1, 0);
+    for (auto& it : edges) head[it[0] + 1]++, head[it[1] + 1]++;
+    for (int i = 0; i < n; i++) head[i + 1] += head[i];
+    vector<pair<int, int>> arcs(head[n]);
+    vector<int> pos(head.begin(), head.end() - 1);
+    for (auto& it : edges) {
+        arcs[pos[it[0]]++] = {it[1], it[2]};
+        arcs[pos[it[1]]++] = {it[0], it[2]};
+    }
+
+    // Step 2: workers pull blocks of sources, each with its own buffers
+    vector<int> reach(n);
+    atomic<int> nextSource(0);
+    const int block = 64;
+    threads = max(1, min(threads, (n + block - 1) / block));
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&]() {
+            ThresholdDijkstra worker;
+            for (int s; (s = nextSource.fetch_add(block)) < n;)
+                for (int src = s; src < min(n, s + block); src++)
+                    reach[src] = worker.run(head, arcs, src, distanceThreshold);
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    // Step 3: smallest count, ties → larger city index
+    int cntCity = INT_MAX;
+    int cityNo = -1;
+    for (int city = 0; city < n; city++) {
+        if (reach[city] <= cntCity) {
+            cntCity = reach[city];
+            cityNo = city;
+        }
+    }
+    return cityNo;
+}
+
 // ---------------------------
 // Example Driver Code
 // ---------------------------
@@ -138,4 +239,6 @@ int main() {
 
     cout << "City with smallest number of reachable cities: "
          << findCity_floydWarshall(n, m, edges, threshold) << endl;
+    cout << "Parallel Dijkstra (threshold cutoff): "
+         << findCity_parallelDijkstra(n, m, edges, threshold) << endl;
 }
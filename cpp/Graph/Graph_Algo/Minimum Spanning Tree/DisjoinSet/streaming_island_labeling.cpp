@@ -0,0 +1,370 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/*
+-----------------------------------------------------
+🔹 STREAMING CONNECTED-COMPONENT LABELING (row by row)
+-----------------------------------------------------
+numsislands(), countDistinctIslands() and MaxConnection() all need
+the whole grid as vector<vector<...>> plus a vis matrix, and recurse
+(or queue) per cell. A satellite mask of 100k x 100k does not fit.
+
+Here the grid is read ONE ROW AT A TIME (from a text stream or an
+mmap'ed raw file) and labelled in a single pass with a DSU over
+provisional labels:
+
+1️⃣ For every land cell of row r look at its already-labelled
+   neighbours: left, up (and up-left / up-right for 8-connectivity).
+   - none labelled → new label
+   - otherwise take one label and unionBySize() with the others
+2️⃣ Every label carries its component's statistics, merged on union:
+   size, bounding box and a translation-invariant shape hash.
+3️⃣ After row r, every label is rewritten to its root. A component
+   whose root appeared in row r-1 but not in row r can never grow
+   again → it is emitted and its label is recycled.
+
+Only the previous and current row of labels are kept, so memory is
+O(M) regardless of the number of rows.
+
+Shape hash (for counting distinct islands):
+    S = Σ A^r * B^c  (mod 2^61 - 1) over the island's cells
+Translating the island by (dr, dc) multiplies S by A^dr * B^dc, so
+    canonical = S * A^(-minRow) * B^(-minCol)
+is identical for equal shapes, no matter where they are, and is
+updated by plain addition when two labels merge.
+-----------------------------------------------------
+*/
+
+struct Component {
+    long long size;
+    int minRow, minCol, maxRow, maxCol;
+    uint64_t shapeHash;   // translation-invariant; compare together with size
+};
+
+/*
+-----------------------------------------------------
+Arithmetic mod 2^61 - 1 for the shape hash
+-----------------------------------------------------
+*/
+static const uint64_t HASH_MOD = (1ULL << 61) - 1;
+
+static uint64_t mulMod(uint64_t a, uint64_t b) {
+    __uint128_t p = (__uint128_t)a * b;
+    uint64_t r = (uint64_t)(p & HASH_MOD) + (uint64_t)(p >> 61);
+    return r >= HASH_MOD ? r - HASH_MOD : r;
+}
+
+static uint64_t addMod(uint64_t a, uint64_t b) {
+    uint64_t r = a + b;
+    return r >= HASH_MOD ? r - HASH_MOD : r;
+}
+
+static uint64_t powMod(uint64_t a, uint64_t e) {
+    uint64_t r = 1;
+    for (; e; e >>= 1, a = mulMod(a, a))
+        if (e & 1) r = mulMod(r, a);
+    return r;
+}
+
+/*
+-----------------------------------------------------
+StreamingLabeler
+-----------------------------------------------------
+pushRow(row) : row[c] != 0 means land, exactly m bytes
+finish()     : flushes the components touching the last row
+Every finished component is passed to the callback once.
+-----------------------------------------------------
+*/
+class StreamingLabeler {
+public:
+    using Callback = function<void(const Component&)>;
+
+    StreamingLabeler(int m, bool diagonal, Callback onComponent)
+        : m(m), diagonal(diagonal), emit(onComponent),
+          prevRow(m, -1), curRow(m, -1), powB(m) {
+        powB[0] = 1;
+        for (int c = 1; c < m; c++) powB[c] = mulMod(powB[c - 1], B);
+        invA = powMod(A, HASH_MOD - 2);
+        invB = powMod(B, HASH_MOD - 2);
+    }
+
+    void pushRow(const uint8_t* row) {
+        newLabels.clear();
+        for (int c = 0; c < m; c++) {
+            curRow[c] = -1;
+            if (!row[c]) continue;
+
+            int lbl = -1;
+            auto join = [&](int other) {
+                if (other < 0) return;
+                if (lbl < 0) lbl = other;
+                else lbl = unionBySize(lbl, other);
+            };
+            if (c > 0) join(curRow[c - 1]);
+            join(prevRow[c]);
+            if (diagonal) {
+                if (c > 0) join(prevRow[c - 1]);
+                if (c + 1 < m) join(prevRow[c + 1]);
+            }
+            if (lbl < 0) {
+                lbl = newLabel();
+                newLabels.push_back(lbl);
+            }
+            addCell(findPar(lbl), c);
+            curRow[c] = lbl;
+        }
+        endRow();
+        rowIdx++;
+        powARow = mulMod(powARow, A);
+    }
+
+    void finish() {
+        // nothing can touch the last row any more
+        fill(curRow.begin(), curRow.end(), -1);
+        newLabels.clear();
+        endRow();
+    }
+
+private:
+    int m;
+    bool diagonal;
+    Callback emit;
+    vector<int> prevRow, curRow;   // labels of previous / current row (-1 = water)
+    int rowIdx = 0;
+
+    // DSU over provisional labels, with recycled slots
+    vector<int> parent, stamp, seen;   // stamp = last row a root was seen in
+    int epoch = 0;
+    vector<Component> stats;
+    vector<int> freeList, newLabels, touched;
+
+    // shape hash bases
+    const uint64_t A = 1000000007ULL, B = 998244353ULL;
+    uint64_t invA, invB, powARow = 1;
+    vector<uint64_t> powB;
+
+    int newLabel() {
+        int id;
+        if (!freeList.empty()) {
+            id = freeList.back();
+            freeList.pop_back();
+        } else {
+            id = parent.size();
+            parent.push_back(0);
+            stamp.push_back(-1);
+            seen.push_back(0);
+            stats.push_back({});
+        }
+        parent[id] = id;
+        stamp[id] = -1;
+        stats[id] = {0, INT_MAX, INT_MAX, -1, -1, 0};
+        return id;
+    }
+
+    int findPar(int node) {
+        if (node == parent[node]) return node;
+        return parent[node] = findPar(parent[node]);
+    }
+
+    int unionBySize(int u, int v) {
+        int ulp_u = findPar(u), ulp_v = findPar(v);
+        if (ulp_u == ulp_v) return ulp_u;
+        if (stats[ulp_u].size < stats[ulp_v].size) swap(ulp_u, ulp_v);
+        parent[ulp_v] = ulp_u;
+        Component& a = stats[ulp_u];
+        const Component& b = stats[ulp_v];
+        a.size += b.size;
+        a.minRow = min(a.minRow, b.minRow);
+        a.minCol = min(a.minCol, b.minCol);
+        a.maxRow = max(a.maxRow, b.maxRow);
+        a.maxCol = max(a.maxCol, b.maxCol);
+        a.shapeHash = addMod(a.shapeHash, b.shapeHash);
+        return ulp_u;
+    }
+
+    void addCell(int root, int c) {
+        Component& s = stats[root];
+        s.size++;
+        s.minRow = min(s.minRow, rowIdx);
+        s.maxRow = max(s.maxRow, rowIdx);
+        s.minCol = min(s.minCol, c);
+        s.maxCol = max(s.maxCol, c);
+        s.shapeHash = addMod(s.shapeHash, mulMod(powARow, powB[c]));
+    }
+
+    void endRow() {
+        // 1. rewrite the current row to roots and mark live roots
+        for (int c = 0; c < m; c++)
+            if (curRow[c] >= 0) {
+                curRow[c] = findPar(curRow[c]);
+                stamp[curRow[c]] = rowIdx;
+            }
+
+        // 2. every label referenced so far: previous row + created now
+        epoch++;
+        touched.clear();
+        for (int c = 0; c < m; c++) {
+            int lbl = prevRow[c];
+            if (lbl >= 0 && seen[lbl] != epoch) {
+                seen[lbl] = epoch;
+                touched.push_back(lbl);
+            }
+        }
+        for (int lbl : newLabels) touched.push_back(lbl);
+        for (int lbl : touched) findPar(lbl);   // full compression
+
+        // 3. recycle non-roots, emit roots that did not reach this row
+        for (int lbl : touched) {
+            if (parent[lbl] != lbl) freeList.push_back(lbl);
+            else if (stamp[lbl] != rowIdx) release(lbl);
+        }
+
+        swap(prevRow, curRow);
+    }
+
+    void release(int root) {
+        Component out = stats[root];
+        out.shapeHash = mulMod(out.shapeHash,
+                               mulMod(powMod(invA, out.minRow), powMod(invB, out.minCol)));
+        emit(out);
+        freeList.push_back(root);
+    }
+};
+
+/*
+-----------------------------------------------------
+Row sources
+-----------------------------------------------------
+TextRowReader : one line per row, '1' = land. The first line fixes
+                the width; shorter lines are padded with water,
+                a longer line ends the stream and sets bad().
+MmapRowReader : raw file of n * m bytes, nonzero = land.
+                The kernel pages rows in as we touch them and
+                can drop them again (MADV_SEQUENTIAL), so the
+                resident set stays a few rows wide.
+-----------------------------------------------------
+*/
+class TextRowReader {
+public:
+    explicit TextRowReader(istream& in) : in(in) {}
+
+    bool next(const uint8_t*& row, int& m) {
+        if (failed || !getline(in, line) || line.empty()) return false;
+        if (width < 0) width = line.size();
+        if ((int)line.size() > width) {
+            failed = true;
+            return false;
+        }
+        buf.assign(width, 0);
+        for (size_t i = 0; i < line.size(); i++) buf[i] = line[i] == '1';
+        row = buf.data();
+        m = width;
+        return true;
+    }
+
+    // true if a row was wider than the first one
+    bool bad() const { return failed; }
+
+private:
+    istream& in;
+    string line;
+    vector<uint8_t> buf;
+    int width = -1;
+    bool failed = false;
+};
+
+class MmapRowReader {
+public:
+    MmapRowReader(const string& path, int m) : m(m) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            len = st.st_size;
+            void* p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                data = (const uint8_t*)p;
+                madvise(p, len, MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+    }
+
+    ~MmapRowReader() {
+        if (data) munmap((void*)data, len);
+    }
+
+    bool next(const uint8_t*& row, int& width) {
+        if (!data || pos + m > len) return false;
+        row = data + pos;
+        width = m;
+        pos += m;
+        return true;
+    }
+
+private:
+    int m;
+    const uint8_t* data = nullptr;
+    size_t len = 0, pos = 0;
+};
+
+// Feed every row of a reader through a labeler
+template <class Reader>
+void labelRows(Reader& reader, bool diagonal, StreamingLabeler::Callback onComponent) {
+    const uint8_t* row;
+    int m, width;
+    if (!reader.next(row, m)) return;
+    StreamingLabeler lab(m, diagonal, onComponent);
+    do lab.pushRow(row); while (reader.next(row, width) && width == m);   // pushRow reads exactly m bytes
+    lab.finish();
+}
+
+/*
+-----------------------------------------------------
+🧭 main() — Example
+-----------------------------------------------------
+The same grids as numsislands (8-connected) and
+countDistinctIslands (4-connected), but streamed.
+-----------------------------------------------------
+*/
+int main() {
+    // numsislands: 8-directional islands
+    istringstream islands("0110\n0110\n0010\n0000\n1111\n");
+    TextRowReader textReader(islands);
+    int cnt = 0;
+    labelRows(textReader, true, [&](const Component&) { cnt++; });
+    cout << "Number of islands (8-connected): " << cnt << endl;
+
+    // countDistinctIslands: 4-directional, shapes up to translation
+    string path = "streaming_islands_demo.bin";
+    vector<string> grid = {"11011", "10000", "00001", "11011"};
+    {
+        ofstream out(path, ios::binary);
+        for (auto& r : grid)
+            for (char ch : r) out.put(ch == '1' ? 1 : 0);
+    }
+    MmapRowReader mmapReader(path, grid[0].size());
+    set<pair<uint64_t, long long>> shapes;
+    long long largest = 0;
+    labelRows(mmapReader, false, [&](const Component& comp) {
+        shapes.insert({comp.shapeHash, comp.size});
+        largest = max(largest, comp.size);
+        cout << "  island size " << comp.size << " bbox (" << comp.minRow << "," << comp.minCol
+             << ")-(" << comp.maxRow << "," << comp.maxCol << ")" << endl;
+    });
+    remove(path.c_str());
+    cout << "Number of distinct islands: " << shapes.size() << endl;
+    cout << "Largest island size: " << largest << endl;
+    return 0;
+}
+
+// | Operation          | Time              | Space                       |
+// | ------------------ | ----------------- | --------------------------- |
+// | pushRow            | O(M * α(M))       | O(M) labels (prev + cur)    |
+// | Whole grid         | O(N * M * α(M))   | O(M) + live components      |
+// | Shape hash finish  | O(log N + log M)  | per emitted component       |
+// Labels are recycled every row, so memory does not grow with N.
@@ -0,0 +1,232 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+-----------------------------------------------------
+🔹 TILED PARALLEL ISLAND COUNTING (DSU seam merge)
+-----------------------------------------------------
+numsislands() walks the whole grid with one sequential BFS per island
+and numOfIslands() grows a single DSU over all N*M cells. Neither uses
+more than one core, and both jump around memory for big islands.
+
+Here the grid (flat, row-major, '1' = land) is cut into T x T tiles:
+
+1️⃣ Tile labelling (parallel, one tile per task):
+   Each worker labels its tile with the classic two-pass scan and a
+   small LOCAL DSU. A 256 x 256 tile is 64 KB of cells + 256 KB of
+   labels, so it stays in L2 while being labelled.
+   Labels are compacted to 0..k-1 per tile.
+2️⃣ Global ids: tile t's components get ids base[t] .. base[t]+k-1
+   (prefix sum over k).
+3️⃣ Seam merge (sequential, cheap): walk every horizontal and vertical
+   tile seam and unionBySize() the components on the two sides
+   (diagonal neighbours too when 8-connected).
+   Every successful union removes one island.
+
+Answer = Σ k  -  successful seam unions.
+-----------------------------------------------------
+*/
+
+class DisjointSet {
+public:
+    vector<int> parent, size;
+
+    DisjointSet(int n) {
+        parent.resize(n);
+        size.resize(n, 1);
+        for (int i = 0; i < n; i++) parent[i] = i;
+    }
+
+    int findPar(int node) {
+        while (node != parent[node]) {
+            parent[node] = parent[parent[node]];  // path halving (no recursion)
+            node = parent[node];
+        }
+        return node;
+    }
+
+    // returns true if u and v were in different sets
+    bool unionBySize(int u, int v) {
+        int ulp_u = findPar(u);
+        int ulp_v = findPar(v);
+        if (ulp_u == ulp_v) return false;
+        if (size[ulp_u] < size[ulp_v]) {
+            parent[ulp_u] = ulp_v;
+            size[ulp_v] += size[ulp_u];
+        } else {
+            parent[ulp_v] = ulp_u;
+            size[ulp_u] += size[ulp_v];
+        }
+        return true;
+    }
+};
+
+class TiledIslandCounter {
+public:
+    TiledIslandCounter(const vector<char>& grid, int n, int m, bool diagonal,
+                       int tile = 256, int threads = max(1u, thread::hardware_concurrency()))
+        : grid(grid), n(n), m(m), diagonal(diagonal), tile(tile), threads(threads),
+          tilesR((n + tile - 1) / tile), tilesC((m + tile - 1) / tile),
+          label((size_t)n * m, -1), compCount(tilesR * tilesC, 0) {}
+
+    int count() {
+        if (n == 0 || m == 0) return 0;
+
+        // 1. label every tile in parallel
+        atomic<int> nextTile(0);
+        int totalTiles = tilesR * tilesC;
+        vector<thread> pool;
+        for (int t = 0; t < min(threads, totalTiles); t++) {
+            pool.emplace_back([&]() {
+                vector<int> localParent;
+                for (int id; (id = nextTile++) < totalTiles;)
+                    labelTile(id, localParent);
+            });
+        }
+        for (auto& th : pool) th.join();
+
+        // 2. global ids per tile
+        base.assign(totalTiles + 1, 0);
+        for (int t = 0; t < totalTiles; t++) base[t + 1] = base[t] + compCount[t];
+        int islands = base[totalTiles];
+
+        // 3. merge across seams
+        DisjointSet ds(islands);
+        auto tryUnion = [&](int r1, int c1, int r2, int c2) {
+            if (c2 < 0 || c2 >= m) return;
+            int a = globalId(r1, c1), b = globalId(r2, c2);
+            if (a >= 0 && b >= 0 && ds.unionBySize(a, b)) islands--;
+        };
+        // horizontal seams: last row of a tile band vs first row of the next
+        for (int r = tile; r < n; r += tile)
+            for (int c = 0; c < m; c++) {
+                if (!isLand(r, c)) continue;
+                tryUnion(r, c, r - 1, c);
+                if (diagonal) {
+                    tryUnion(r, c, r - 1, c - 1);
+                    tryUnion(r, c, r - 1, c + 1);
+                }
+            }
+        // vertical seams: last column of a tile vs first column of the next
+        for (int c = tile; c < m; c += tile)
+            for (int r = 0; r < n; r++) {
+                if (!isLand(r, c)) continue;
+                tryUnion(r, c, r, c - 1);
+                if (diagonal) {
+                    if (r > 0) tryUnion(r, c, r - 1, c - 1);
+                    if (r + 1 < n) tryUnion(r, c, r + 1, c - 1);
+                }
+            }
+        return islands;
+    }
+
+private:
+    const vector<char>& grid;
+    int n, m;
+    bool diagonal;
+    int tile, threads, tilesR, tilesC;
+    vector<int> label;       // compact per-tile label of each land cell
+    vector<int> compCount;   // components per tile
+    vector<int> base;        // first global id of each tile
+
+    bool isLand(int r, int c) const { return grid[(size_t)r * m + c] == '1'; }
+
+    int globalId(int r, int c) const {
+        int l = label[(size_t)r * m + c];
+        if (l < 0) return -1;
+        return base[(r / tile) * tilesC + c / tile] + l;
+    }
+
+    static int findLocal(vector<int>& parent, int x) {
+        while (x != parent[x]) x = parent[x] = parent[parent[x]];
+        return x;
+    }
+
+    // Two-pass scan labelling restricted to one tile
+    void labelTile(int id, vector<int>& parent) {
+        int r0 = (id / tilesC) * tile, c0 = (id % tilesC) * tile;
+        int r1 = min(n, r0 + tile), c1 = min(m, c0 + tile);
+        parent.clear();
+
+        auto lab = [&](int r, int c) -> int {
+            if (r < r0 || c < c0 || c >= c1) return -1;
+            return label[(size_t)r * m + c];
+        };
+        auto unite = [&](int a, int b) {
+            a = findLocal(parent, a), b = findLocal(parent, b);
+            if (a != b) parent[max(a, b)] = min(a, b);
+        };
+
+        // pass 1: provisional labels
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++) {
+                if (!isLand(r, c)) continue;
+                int cand[4] = {lab(r, c - 1), lab(r - 1, c), -1, -1};
+                if (diagonal) cand[2] = lab(r - 1, c - 1), cand[3] = lab(r - 1, c + 1);
+                int l = -1;
+                for (int x : cand) {
+                    if (x < 0) continue;
+                    if (l < 0) l = x;
+                    else unite(l, x);
+                }
+                if (l < 0) {
+                    l = parent.size();
+                    parent.push_back(l);
+                }
+                label[(size_t)r * m + c] = l;
+            }
+
+        // compact roots to 0..k-1
+        int k = 0;
+        vector<int> compact(parent.size(), -1);
+        for (int i = 0; i < (int)parent.size(); i++) {
+            int root = findLocal(parent, i);
+            if (compact[root] < 0) compact[root] = k++;
+            compact[i] = compact[root];
+        }
+
+        // pass 2: rewrite
+        for (int r = r0; r < r1; r++)
+            for (int c = c0; c < c1; c++) {
+                int& l = label[(size_t)r * m + c];
+                if (l >= 0) l = compact[l];
+            }
+        compCount[id] = k;
+    }
+};
+
+/*
+-----------------------------------------------------
+🧭 main() — Example
+-----------------------------------------------------
+Same grid as numsislands() (8-connected → 2 islands).
+A tiny tile size is used so islands really cross seams.
+-----------------------------------------------------
+*/
+int main() {
+    vector<string> rows = {
+        "0110",
+        "0110",
+        "0010",
+        "0000",
+        "1111"
+    };
+    int n = rows.size(), m = rows[0].size();
+    vector<char> grid;
+    for (auto& r : rows) grid.insert(grid.end(), r.begin(), r.end());
+
+    TiledIslandCounter eight(grid, n, m, true, 2, 4);
+    cout << "Number of islands (8-connected, 2x2 tiles): " << eight.count() << endl;
+
+    TiledIslandCounter four(grid, n, m, false, 2, 4);
+    cout << "Number of islands (4-connected, 2x2 tiles): " << four.count() << endl;
+    return 0;
+}
+
+// | Phase          | Time                          | Space                  |
+// | -------------- | ----------------------------- | ---------------------- |
+// | Tile labelling | O(N*M / P) with P threads     | O(N*M) labels          |
+// | Seam merge     | O(N*M / T * α) (seams only)   | O(#tile components)    |
+// | Total          | ≈ O(N*M / P)                  | O(N*M)                 |
+// T = tile side, P = threads. The DSU only holds per-tile components,
+// not every cell as in numOfIslands().
@@ -0,0 +1,220 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+--------------------------------------------
+Alien Dictionary over a stream of sorted words
+--------------------------------------------
+findOrder(dict, N, K) needs every word in a C array and only knows
+the K letters 'a'..'a'+K-1. Inferring a collation order from a
+multi-gigabyte sorted dump needs something else:
+
+1️⃣ Words are read one line at a time. Only the PREVIOUS word is
+   kept, so memory per adjacent pair is constant (two words).
+2️⃣ Lines are UTF-8 and decoded to Unicode code points; each new
+   code point gets a dense id on first sight.
+3️⃣ For each adjacent pair the first mismatching position gives one
+   precedence edge a < b. Duplicate edges are dropped with a hash
+   set, so the graph is at most (#symbols)^2 however long the dump.
+4️⃣ Contradictions are detected:
+   - prefix violation: "abc" followed by "ab" can never be sorted
+     (reported with its line number, right away)
+   - cyclic constraints: after the stream, Kahn's algorithm cannot
+     place every symbol → one offending cycle is reported, each
+     edge with the line that first produced it.
+--------------------------------------------
+*/
+
+struct AlienOrderResult {
+    bool ok = true;
+    vector<char32_t> order;   // valid when ok
+    string error;             // why it is not, when !ok
+};
+
+// Decode one UTF-8 line into code points (invalid bytes -> U+FFFD)
+void decodeUtf8(const string& s, vector<char32_t>& out) {
+    out.clear();
+    for (size_t i = 0; i < s.size();) {
+        unsigned char c = s[i];
+        int len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 0;
+        if (len == 0 || i + len > s.size()) {
+            out.push_back(0xFFFD);
+            i++;
+            continue;
+        }
+        char32_t cp = len == 1 ? c : c & (0x7F >> len);
+        bool valid = true;
+        for (int k = 1; k < len; k++) {
+            unsigned char cc = s[i + k];
+            if ((cc & 0xC0) != 0x80) valid = false;
+            cp = cp << 6 | (cc & 0x3F);
+        }
+        out.push_back(valid ? cp : 0xFFFD);
+        i += valid ? len : 1;
+    }
+}
+
+string encodeUtf8(char32_t cp) {
+    string s;
+    if (cp < 0x80) s += (char)cp;
+    else if (cp < 0x800) s += (char)(0xC0 | cp >> 6), s += (char)(0x80 | (cp & 0x3F));
+    else if (cp < 0x10000)
+        s += (char)(0xE0 | cp >> 12), s += (char)(0x80 | (cp >> 6 & 0x3F)), s += (char)(0x80 | (cp & 0x3F));
+    else
+        s += (char)(0xF0 | cp >> 18), s += (char)(0x80 | (cp >> 12 & 0x3F)),
+            s += (char)(0x80 | (cp >> 6 & 0x3F)), s += (char)(0x80 | (cp & 0x3F));
+    return s;
+}
+
+class AlienOrderStream {
+public:
+    // Feed the next word of the sorted dump
+    void addWord(const string& line) {
+        lineNo++;
+        decodeUtf8(line, cur);
+        for (char32_t cp : cur) idOf(cp);
+
+        if (lineNo > 1 && error.empty()) {
+            size_t len = min(prev.size(), cur.size()), j = 0;
+            while (j < len && prev[j] == cur[j]) j++;
+            if (j < len) {
+                addConstraint(idOf(prev[j]), idOf(cur[j]));
+            } else if (prev.size() > cur.size()) {
+                error = "line " + to_string(lineNo) + ": word is a proper prefix of the previous word";
+            }
+        }
+        swap(prev, cur);
+    }
+
+    // Read every line of the stream
+    void consume(istream& in) {
+        string line;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            addWord(line);
+        }
+    }
+
+    AlienOrderResult result() const {
+        AlienOrderResult res;
+        if (!error.empty()) {
+            res.ok = false;
+            res.error = error;
+            return res;
+        }
+
+        // Kahn's algorithm; ties broken by first appearance
+        int V = symbols.size();
+        vector<int> indegree(V, 0);
+        for (int u = 0; u < V; u++)
+            for (auto& e : adj[u]) indegree[e.first]++;
+        priority_queue<int, vector<int>, greater<int>> q;
+        for (int i = 0; i < V; i++)
+            if (indegree[i] == 0) q.push(i);
+        while (!q.empty()) {
+            int node = q.top();
+            q.pop();
+            res.order.push_back(symbols[node]);
+            for (auto& e : adj[node])
+                if (--indegree[e.first] == 0) q.push(e.first);
+        }
+        if ((int)res.order.size() == V) return res;
+
+        res.ok = false;
+        res.order.clear();
+        res.error = "contradictory order: " + describeCycle(indegree);
+        return res;
+    }
+
+private:
+    vector<char32_t> prev, cur;
+    long long lineNo = 0;
+    string error;
+
+    unordered_map<char32_t, int> ids;
+    vector<char32_t> symbols;
+    vector<vector<pair<int, long long>>> adj;   // {to, line that produced it}
+    unordered_set<uint64_t> seenEdges;
+
+    int idOf(char32_t cp) {
+        auto it = ids.find(cp);
+        if (it != ids.end()) return it->second;
+        int id = symbols.size();
+        ids[cp] = id;
+        symbols.push_back(cp);
+        adj.emplace_back();
+        return id;
+    }
+
+    void addConstraint(int a, int b) {
+        if (seenEdges.insert((uint64_t)a << 32 | (uint32_t)b).second)
+            adj[a].push_back({b, lineNo});
+    }
+
+    // Every unplaced symbol (indegree still > 0) has an unplaced
+    // predecessor, so walking predecessors must run into a cycle
+    string describeCycle(const vector<int>& indegree) const {
+        int V = symbols.size();
+        vector<pair<int, long long>> pred(V, {-1, 0});
+        for (int u = 0; u < V; u++)
+            if (indegree[u] > 0)
+                for (auto& e : adj[u])
+                    if (indegree[e.first] > 0) pred[e.first] = {u, e.second};
+
+        int x = 0;
+        while (indegree[x] == 0) x++;
+        vector<int> pos(V, -1), walk;
+        while (pos[x] < 0) {
+            pos[x] = walk.size();
+            walk.push_back(x);
+            x = pred[x].first;
+        }
+        vector<int> cyc(walk.begin() + pos[x], walk.end());
+        reverse(cyc.begin(), cyc.end());   // now follows edge direction
+
+        string s;
+        for (size_t i = 0; i < cyc.size(); i++) {
+            int from = cyc[i], to = cyc[(i + 1) % cyc.size()];
+            s += encodeUtf8(symbols[from]) + " < " + encodeUtf8(symbols[to]) +
+                 " (line " + to_string(pred[to].second) + ")";
+            if (i + 1 < cyc.size()) s += ", ";
+        }
+        return s;
+    }
+};
+
+// ---------- DRIVER CODE ----------
+int main() {
+    istringstream dump("baa\nabcd\nabca\ncab\ncad\n");
+    AlienOrderStream alien;
+    alien.consume(dump);
+    AlienOrderResult res = alien.result();
+    cout << "Alien Dictionary Order: ";
+    for (char32_t c : res.order) cout << encodeUtf8(c);
+    cout << endl;
+
+    // Greek letters: α < β < γ
+    istringstream greek("αβ\nαγ\nβα\nγ\n");
+    AlienOrderStream g;
+    g.consume(greek);
+    res = g.result();
+    cout << "Greek order: ";
+    for (char32_t c : res.order) cout << encodeUtf8(c) << " ";
+    cout << endl;
+
+    // a < b (line 2), b < c (line 3), c < a (line 4)
+    istringstream bad("ab\nb\nc\na\n");
+    AlienOrderStream contradiction;
+    contradiction.consume(bad);
+    res = contradiction.result();
+    cout << (res.ok ? "ok" : res.error) << endl;
+    return 0;
+}
+
+// Time Complexity
+// Stream: O(total characters) decoding + comparing adjacent words
+// Topological sort: O(S + E), S = distinct symbols, E ≤ S²
+//
+// 💾 Space Complexity
+// Two words at a time + O(S + E) for the constraint graph,
+// independent of the number of words in the dump.
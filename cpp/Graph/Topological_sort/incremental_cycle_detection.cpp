@@ -0,0 +1,286 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+--------------------------------------------
+Incremental Cycle Detection
+--------------------------------------------
+isCycle() (BFS / DFS, undirected), isCycle() (DFS, directed) and
+isCyclicKahn() all rescan the WHOLE graph. A config validator that
+re-runs them after every edit pays O(V + E) per edit.
+
+These structures live as long as the graph and answer, per inserted
+edge, "does this edge close a cycle?":
+
+UndirectedCycleDetector — DSU
+    u, v already in the same set  ⇔  edge (u, v) closes a cycle.
+    O(α(V)) per edge. Edges that merged two sets form a spanning
+    forest; the cycle is the forest path u ~> v plus (v, u).
+
+DirectedCycleDetector — incremental topological order
+(Pearce–Kelly). Every node has a position ord[x] such that every
+edge goes from a smaller to a larger position.
+    add u -> v:
+    1️⃣ ord[u] < ord[v]  → order still valid, O(1).
+    2️⃣ otherwise only the nodes with ord in [ord[v], ord[u]] can be
+       affected:
+       - forward DFS from v, staying below ord[u]; reaching u means
+         v ~> u exists, so u -> v closes a cycle (that DFS path)
+       - backward DFS from u, staying above ord[v]
+       - reassign the positions the two visited sets already
+         used: backward set first, then forward set (each keeps
+         its relative order).
+    Work is proportional to the affected region, not to the graph.
+
+An edge that would close a cycle is REJECTED (not inserted), so the
+stored graph stays acyclic and the reported cycle is exact.
+--------------------------------------------
+*/
+
+class UndirectedCycleDetector {
+public:
+    // true if the edge closes a cycle (edge is not inserted then)
+    bool addEdge(int u, int v) {
+        ensure(max(u, v) + 1);
+        int ru = findPar(u), rv = findPar(v);
+        if (ru == rv) {
+            rejected = {u, v};   // path built only if cycle() is asked
+            cycleBuilt = false;
+            return true;
+        }
+        if (size[ru] < size[rv]) swap(ru, rv);
+        parent[rv] = ru;
+        size[ru] += size[rv];
+        forest[u].push_back(v);
+        forest[v].push_back(u);
+        return false;
+    }
+
+    // vertices of the cycle found by the last rejected edge; the forest
+    // only gains edges between different trees, so the u ~> v path is
+    // still the one that existed when the edge was rejected
+    const vector<int>& cycle() const {
+        if (!cycleBuilt) {
+            lastCycle = rejected.first < 0 ? vector<int>() : forestPath(rejected.first, rejected.second);
+            cycleBuilt = true;
+        }
+        return lastCycle;
+    }
+
+private:
+    vector<int> parent, size;
+    vector<vector<int>> forest;
+    pair<int, int> rejected = {-1, -1};
+    mutable vector<int> lastCycle;
+    mutable bool cycleBuilt = true;
+
+    void ensure(int n) {
+        for (int x = parent.size(); x < n; x++) {
+            parent.push_back(x);
+            size.push_back(1);
+            forest.emplace_back();
+        }
+    }
+
+    int findPar(int node) {
+        if (node == parent[node]) return node;
+        return parent[node] = findPar(parent[node]);
+    }
+
+    vector<int> forestPath(int u, int v) const {
+        if (u == v) return {u};   // self-loop
+        unordered_map<int, int> from;
+        queue<int> q;
+        q.push(u);
+        from[u] = u;
+        while (!from.count(v)) {
+            int x = q.front();
+            q.pop();
+            for (int y : forest[x])
+                if (!from.count(y)) {
+                    from[y] = x;
+                    q.push(y);
+                }
+        }
+        vector<int> path;
+        for (int x = v; x != u; x = from[x]) path.push_back(x);
+        path.push_back(u);
+        reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+class DirectedCycleDetector {
+public:
+    // true if u -> v closes a cycle (edge is not inserted then)
+    bool addEdge(int u, int v) {
+        ensure(max(u, v) + 1);
+        if (u == v) {
+            lastCycle = {u};
+            return true;
+        }
+        int lb = ord[v], ub = ord[u];
+        if (lb > ub) {   // already consistent
+            out[u].push_back(v);
+            in[v].push_back(u);
+            return false;
+        }
+
+        // forward search from v inside [lb, ub]
+        deltaF.clear();
+        from.clear();
+        from[v] = -1;
+        if (forwardReaches(v, u, ub)) {
+            lastCycle.clear();
+            for (int x = u; x != -1; x = from[x]) lastCycle.push_back(x);
+            reverse(lastCycle.begin(), lastCycle.end());   // v ... u, then u -> v
+            clearMarks();
+            return true;
+        }
+
+        // backward search from u inside [lb, ub]
+        deltaB.clear();
+        backward(u, lb);
+        reorder();
+        clearMarks();
+
+        out[u].push_back(v);
+        in[v].push_back(u);
+        return false;
+    }
+
+    // the cycle closed by the last rejected edge: v ~> u, then u -> v
+    const vector<int>& cycle() const { return lastCycle; }
+
+    // a valid topological order of the accepted edges
+    vector<int> topoOrder() const {
+        vector<int> res(ord.size());
+        for (int x = 0; x < (int)ord.size(); x++) res[ord[x]] = x;
+        return res;
+    }
+
+private:
+    vector<vector<int>> out, in;
+    vector<int> ord;            // position of each node in the order
+    vector<char> mark;
+    vector<int> deltaF, deltaB, lastCycle;
+    unordered_map<int, int> from;
+
+    void ensure(int n) {
+        for (int x = ord.size(); x < n; x++) {
+            ord.push_back(x);   // new nodes go to the end of the order
+            out.emplace_back();
+            in.emplace_back();
+            mark.push_back(0);
+        }
+    }
+
+    // iterative DFS from v over nodes with ord <= ub; true if target seen
+    bool forwardReaches(int v, int target, int ub) {
+        vector<int> st = {v};
+        mark[v] = 1;
+        deltaF.push_back(v);
+        while (!st.empty()) {
+            int x = st.back();
+            st.pop_back();
+            for (int y : out[x]) {
+                if (y == target) {
+                    from[y] = x;
+                    return true;
+                }
+                if (!mark[y] && ord[y] < ub) {
+                    mark[y] = 1;
+                    from[y] = x;
+                    deltaF.push_back(y);
+                    st.push_back(y);
+                }
+            }
+        }
+        return false;
+    }
+
+    void backward(int u, int lb) {
+        vector<int> st = {u};
+        mark[u] = 2;
+        deltaB.push_back(u);
+        while (!st.empty()) {
+            int x = st.back();
+            st.pop_back();
+            for (int y : in[x])
+                if (!mark[y] && ord[y] > lb) {
+                    mark[y] = 2;
+                    deltaB.push_back(y);
+                    st.push_back(y);
+                }
+        }
+    }
+
+    void reorder() {
+        auto byOrd = [&](int a, int b) { return ord[a] < ord[b]; };
+        sort(deltaF.begin(), deltaF.end(), byOrd);
+        sort(deltaB.begin(), deltaB.end(), byOrd);
+
+        vector<int> nodes(deltaB);   // everything reaching u comes first
+        nodes.insert(nodes.end(), deltaF.begin(), deltaF.end());
+        vector<int> slots;
+        for (int x : nodes) slots.push_back(ord[x]);
+        sort(slots.begin(), slots.end());
+        for (size_t i = 0; i < nodes.size(); i++) ord[nodes[i]] = slots[i];
+    }
+
+    void clearMarks() {
+        for (int x : deltaF) mark[x] = 0;
+        for (int x : deltaB) mark[x] = 0;
+        deltaB.clear();
+    }
+};
+
+/*
+--------------------------------------------
+Main Function
+--------------------------------------------
+*/
+int main() {
+    // config dependencies arriving one edit at a time
+    DirectedCycleDetector dag;
+    vector<pair<int, int>> edits = {{0, 1}, {1, 2}, {3, 0}, {2, 4}, {4, 3}, {2, 3}};
+    for (auto [u, v] : edits) {
+        cout << "add " << u << " -> " << v << ": ";
+        if (dag.addEdge(u, v)) {
+            cout << "closes cycle";
+            for (int x : dag.cycle()) cout << " " << x;
+            cout << " -> " << dag.cycle().front() << endl;
+        } else {
+            cout << "ok" << endl;
+        }
+    }
+    cout << "Topological order:";
+    for (int x : dag.topoOrder()) cout << " " << x;
+    cout << endl;
+
+    UndirectedCycleDetector ug;
+    vector<pair<int, int>> links = {{0, 1}, {1, 2}, {3, 4}, {2, 0}};
+    for (auto [u, v] : links) {
+        cout << "add " << u << " - " << v << ": ";
+        if (ug.addEdge(u, v)) {
+            cout << "closes cycle";
+            for (int x : ug.cycle()) cout << " " << x;
+            cout << endl;
+        } else {
+            cout << "ok" << endl;
+        }
+    }
+    return 0;
+}
+
+/*
+--------------------------------------------
+Time Complexity (per inserted edge):
+    - Undirected: O(α(V)) amortized; cycle report O(V) when asked
+    - Directed  : O(1) if the order is already valid, otherwise
+                  O(|affected| log |affected| + their edges)
+Space Complexity:
+    - Undirected: O(V) (DSU + spanning forest)
+    - Directed  : O(V + E) adjacency + O(V) order
+--------------------------------------------
+*/
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../../../fast_io.h"
 using namespace std;
 
 /*
@@ -42,15 +43,18 @@ vector<int> bfsofgraph(int n, vector<int> adj[]) {
 Main function: Demonstrates BFS traversal
 */
 int main() {
+    FastReader in;
+    FastWriter out;
+
     int n, m;
-    cin >> n >> m; // number of vertices and edges
+    in >> n >> m; // number of vertices and edges
 
     vector<int> adj[n];
 
     // Building the adjacency list
     for (int i = 0; i < m; i++) {
         int u, v;
-        cin >> u >> v;
+        in >> u >> v;
         adj[u].push_back(v);
         adj[v].push_back(u); // remove this for directed graph
     }
@@ -58,11 +62,11 @@ int main() {
     // Get BFS traversal
     vector<int> bfs = bfsofgraph(n, adj);
 
-    cout << "BFS Traversal: ";
+    out << "BFS Traversal: ";
     for (auto node : bfs) {
-        cout << node << " ";
+        out << node << " ";
     }
-    cout << endl;
+    out << '\n';
 
     return 0;
 }
@@ -0,0 +1,296 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+Problem Statement:
+------------------
+Same as distance_of_nearest_cell_having_1.cpp: for every cell of a
+binary N x M grid, find the distance to the nearest cell containing 1.
+Here the grid is a large image stored as one flat row-major buffer,
+and we want Euclidean, Manhattan or Chebyshev distance.
+
+Why not BFS?
+------------
+Multi-source BFS with a queue of {{row, col}, dist} touches every
+cell through a queue in random-ish order and only gives the
+4-neighbour (Manhattan) metric. A separable distance transform
+does two straight passes over the buffer instead:
+
+1️⃣ Column pass: for every column, the 1D distance to the nearest
+   feature in that column.
+2️⃣ Row pass: for every row, combine the column results along the row.
+
+Every column (and every row) is independent, so each pass is split
+across threads.
+
+Metrics:
+--------
+- Euclidean (exact, squared): Felzenszwalb–Huttenlocher.
+  The 1D transform d(q) = min_p ((q - p)^2 + f(p)) is the lower
+  envelope of parabolas rooted at p; it is built in one sweep and
+  read back in another -> O(len).
+- Manhattan: d(q) = min_p (|q - p| + f(p)) is two sweeps
+  (forward: f[i] = min(f[i], f[i-1] + 1), then backward).
+  Column pass is done row by row so it stays sequential in memory.
+- Chebyshev: classic two-sweep raster chamfer with the 8-neighbour
+  mask (forward raster, then backward raster). This one is exact
+  but row-dependent, so it runs on a single thread.
+
+Output is written in place: feature cells become 0, others get the
+distance (SQUARED distance for Euclidean), -1 if the grid has no 1 at all.
+Squared distances reach (N-1)^2 + (M-1)^2, more than an int holds
+beyond ~32768 x 32768: then the in-place call refuses (returns false)
+and euclideanDistanceSq gives the result as long long instead.
+*/
+
+enum class Metric { Euclidean, Manhattan, Chebyshev };
+
+const long long DT_INF = LLONG_MAX / 4;
+
+// Split [0, total) into `threads` chunks and run fn(lo, hi, tid) on each
+template <class F>
+void parallelFor(int total, int threads, F fn) {
+    threads = max(1, min(threads, total));
+    vector<thread> pool;
+    int chunk = (total + threads - 1) / threads;
+    for (int t = 0; t < threads; t++) {
+        int lo = t * chunk, hi = min(total, lo + chunk);
+        if (lo >= hi) break;
+        pool.emplace_back(fn, lo, hi, t);
+    }
+    for (auto& th : pool) th.join();
+}
+
+/*
+Felzenszwalb–Huttenlocher 1D squared-Euclidean transform.
+f, d : length len (d must not alias f)
+v, z : scratch of size len and len + 1
+Infinite entries of f contribute no parabola.
+*/
+void edt1D(const long long* f, long long* d, int len, int* v, double* z) {
+    int k = -1;
+    for (int q = 0; q < len; q++) {
+        if (f[q] >= DT_INF) continue;
+        double s = -1e300;
+        while (k >= 0) {
+            int p = v[k];
+            s = ((f[q] + (long long)q * q) - (f[p] + (long long)p * p)) / (2.0 * (q - p));
+            if (s > z[k]) break;
+            k--;
+        }
+        if (k < 0) s = -1e300;
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = 1e300;
+    }
+    if (k < 0) {
+        for (int q = 0; q < len; q++) d[q] = DT_INF;
+        return;
+    }
+    int j = 0;
+    for (int q = 0; q < len; q++) {
+        while (z[j + 1] < q) j++;
+        long long diff = q - v[j];
+        d[q] = diff * diff + f[v[j]];
+    }
+}
+
+// 1D Manhattan transform in place: two sweeps
+void l1Dist1D(int* f, int len) {
+    for (int i = 1; i < len; i++) f[i] = min(f[i], f[i - 1] + 1);
+    for (int i = len - 2; i >= 0; i--) f[i] = min(f[i], f[i + 1] + 1);
+}
+
+// largest squared distance the Euclidean output can hold in T
+template <class T>
+bool euclideanFits(int n, int m) {
+    return (long long)(n - 1) * (n - 1) + (long long)(m - 1) * (m - 1) < numeric_limits<T>::max();
+}
+
+// out may be grid itself (T = int): a column is read whole before it is written
+template <class T>
+void euclideanTransform(const vector<int>& grid, vector<T>& out, int n, int m, int threads) {
+    const T NONE = numeric_limits<T>::max();
+    // column pass -> squared vertical distance (NONE = column has no feature)
+    parallelFor(m, threads, [&](int lo, int hi, int) {
+        vector<long long> f(n), d(n);
+        vector<int> v(n);
+        vector<double> z(n + 1);
+        for (int c = lo; c < hi; c++) {
+            for (int r = 0; r < n; r++) f[r] = grid[(size_t)r * m + c] ? 0 : DT_INF;
+            edt1D(f.data(), d.data(), n, v.data(), z.data());
+            for (int r = 0; r < n; r++)
+                out[(size_t)r * m + c] = d[r] >= DT_INF ? NONE : (T)d[r];
+        }
+    });
+
+    // row pass
+    parallelFor(n, threads, [&](int lo, int hi, int) {
+        vector<long long> f(m), d(m);
+        vector<int> v(m);
+        vector<double> z(m + 1);
+        for (int r = lo; r < hi; r++) {
+            T* row = out.data() + (size_t)r * m;
+            for (int c = 0; c < m; c++) f[c] = row[c] == NONE ? DT_INF : row[c];
+            edt1D(f.data(), d.data(), m, v.data(), z.data());
+            for (int c = 0; c < m; c++) row[c] = d[c] >= DT_INF ? -1 : (T)d[c];
+        }
+    });
+}
+
+void manhattanTransform(vector<int>& grid, int n, int m, int threads) {
+    const int INF = INT_MAX / 2;
+    // column pass, done row by row so memory is read sequentially;
+    // threads own disjoint column ranges
+    parallelFor(m, threads, [&](int lo, int hi, int) {
+        for (int r = 0; r < n; r++)
+            for (int c = lo; c < hi; c++) {
+                int& cur = grid[(size_t)r * m + c];
+                cur = cur ? 0 : INF;
+                if (r > 0) cur = min(cur, grid[(size_t)(r - 1) * m + c] + 1);
+            }
+        for (int r = n - 2; r >= 0; r--)
+            for (int c = lo; c < hi; c++) {
+                int& cur = grid[(size_t)r * m + c];
+                cur = min(cur, grid[(size_t)(r + 1) * m + c] + 1);
+            }
+    });
+
+    // row pass
+    parallelFor(n, threads, [&](int lo, int hi, int) {
+        for (int r = lo; r < hi; r++) {
+            int* row = grid.data() + (size_t)r * m;
+            l1Dist1D(row, m);
+            for (int c = 0; c < m; c++)
+                if (row[c] >= INF) row[c] = -1;
+        }
+    });
+}
+
+void chebyshevTransform(vector<int>& grid, int n, int m) {
+    const int INF = INT_MAX / 2;
+    for (auto& x : grid) x = x ? 0 : INF;
+
+    auto at = [&](int r, int c) -> int& { return grid[(size_t)r * m + c]; };
+    // forward raster: neighbours above and to the left
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < m; c++) {
+            int& cur = at(r, c);
+            if (c > 0) cur = min(cur, at(r, c - 1) + 1);
+            if (r > 0) {
+                cur = min(cur, at(r - 1, c) + 1);
+                if (c > 0) cur = min(cur, at(r - 1, c - 1) + 1);
+                if (c + 1 < m) cur = min(cur, at(r - 1, c + 1) + 1);
+            }
+        }
+    // backward raster: neighbours below and to the right
+    for (int r = n - 1; r >= 0; r--)
+        for (int c = m - 1; c >= 0; c--) {
+            int& cur = at(r, c);
+            if (c + 1 < m) cur = min(cur, at(r, c + 1) + 1);
+            if (r + 1 < n) {
+                cur = min(cur, at(r + 1, c) + 1);
+                if (c > 0) cur = min(cur, at(r + 1, c - 1) + 1);
+                if (c + 1 < m) cur = min(cur, at(r + 1, c + 1) + 1);
+            }
+        }
+    for (auto& x : grid)
+        if (x >= INF) x = -1;
+}
+
+/*
+distanceTransform(grid, n, m, metric, threads)
+- grid : flat row-major, nonzero = feature (the '1' cells)
+- overwritten with the distance to the nearest feature
+  (squared distance for Metric::Euclidean)
+- false (grid untouched) if Euclidean squared distances would not
+  fit in int → use euclideanDistanceSq
+*/
+bool distanceTransform(vector<int>& grid, int n, int m, Metric metric,
+                       int threads = max(1u, thread::hardware_concurrency())) {
+    if (n == 0 || m == 0) return true;
+    if (metric == Metric::Euclidean) {
+        if (!euclideanFits<int>(n, m)) return false;
+        euclideanTransform(grid, grid, n, m, threads);
+    } else if (metric == Metric::Manhattan) manhattanTransform(grid, n, m, threads);
+    else chebyshevTransform(grid, n, m);
+    return true;
+}
+
+// squared Euclidean distances as long long: any image size, grid unchanged
+vector<long long> euclideanDistanceSq(const vector<int>& grid, int n, int m,
+                                      int threads = max(1u, thread::hardware_concurrency())) {
+    vector<long long> out((size_t)n * m);
+    if (n > 0 && m > 0) euclideanTransform(grid, out, n, m, threads);
+    return out;
+}
+
+void printGrid(const vector<int>& grid, int n, int m) {
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < m; c++) cout << grid[r * m + c] << " ";
+        cout << "\n";
+    }
+}
+
+int main() {
+    int n = 4, m = 4;
+    vector<int> grid = {
+        1, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 1
+    };
+
+    vector<int> l1 = grid;
+    distanceTransform(l1, n, m, Metric::Manhattan);
+    cout << "Manhattan distance of nearest 1 (same as BFS):\n";
+    printGrid(l1, n, m);
+
+    vector<int> l2 = grid;
+    distanceTransform(l2, n, m, Metric::Euclidean);
+    cout << "Squared Euclidean distance of nearest 1:\n";
+    printGrid(l2, n, m);
+
+    vector<int> linf = grid;
+    distanceTransform(linf, n, m, Metric::Chebyshev);
+    cout << "Chebyshev distance of nearest 1:\n";
+    printGrid(linf, n, m);
+
+    return 0;
+}
+
+/*
+Expected Output:
+----------------
+Manhattan distance of nearest 1 (same as BFS):
+0 1 2 3
+1 2 3 2
+2 3 2 1
+3 2 1 0
+Squared Euclidean distance of nearest 1:
+0 1 4 9
+1 2 5 4
+4 5 2 1
+9 4 1 0
+Chebyshev distance of nearest 1:
+0 1 2 3
+1 1 2 2
+2 2 1 1
+3 2 1 0
+
+--------------------------------------------
+Time Complexity:
+--------------------------------------------
+O(N × M) for every metric (two linear passes),
+divided by the number of threads for Euclidean / Manhattan.
+
+--------------------------------------------
+Space Complexity:
+--------------------------------------------
+- In place: the column pass is stored in the caller's buffer
+  (Euclidean in place needs (N-1)^2 + (M-1)^2 < INT_MAX;
+  euclideanDistanceSq needs an extra N × M long longs instead)
+- O(N + M) scratch per thread
+--------------------------------------------
+*/
@@ -0,0 +1,392 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+====================================================
+Reusable Multi-Source Grid BFS Engine
+====================================================
+rotten_oranges.cpp, distance_of_nearest_cell_having_1.cpp,
+Number_of_enclaves.cpp, surrounded_regions_replace_Os_with_X.cpp
+and flood_fill.cpp all write their own traversal over a
+vector<vector<int>> grid plus a separate vector<vector<int>> vis.
+
+For a 20k x 20k raster mask that layout costs:
+- 20k heap allocations (one per row) + 24 bytes header per row
+- 4 bytes per cell for the grid and 4 more for vis
+  -> ~3.2 GB before the queue is even allocated.
+
+This file offers ONE engine that:
+1️⃣ Works on a flat row-major buffer (1 byte per cell).
+2️⃣ Keeps "visited" as a bit-packed set (1 bit per cell).
+3️⃣ Seeds the BFS with any number of sources (multi-source).
+4️⃣ Supports 4- or 8-connectivity.
+5️⃣ Has a word-parallel bitset flood-fill mode: a whole BFS
+   level is advanced 64 cells per machine word with shifts,
+   ORs and ANDs (the compiler vectorises the row loops), so
+   no queue is needed at all.
+====================================================
+*/
+
+/*
+----------------------------------------------------
+BitGrid: n x m bits, each row padded to whole words
+----------------------------------------------------
+*/
+class BitGrid {
+public:
+    int n, m, W;              // rows, cols, 64-bit words per row
+    vector<uint64_t> bits;
+
+    BitGrid(int n, int m) : n(n), m(m), W((m + 63) / 64), bits((size_t)n * W, 0) {}
+
+    uint64_t* row(int r) { return bits.data() + (size_t)r * W; }
+    const uint64_t* row(int r) const { return bits.data() + (size_t)r * W; }
+
+    bool test(int r, int c) const { return row(r)[c >> 6] >> (c & 63) & 1; }
+    void set(int r, int c) { row(r)[c >> 6] |= 1ULL << (c & 63); }
+    void reset() { fill(bits.begin(), bits.end(), 0); }
+
+    // true if the bit was newly set
+    bool testAndSet(size_t cell) {
+        int r = cell / m, c = cell % m;
+        uint64_t& w = row(r)[c >> 6];
+        uint64_t mask = 1ULL << (c & 63);
+        if (w & mask) return false;
+        w |= mask;
+        return true;
+    }
+
+    size_t count() const {
+        size_t cnt = 0;
+        for (uint64_t w : bits) cnt += __builtin_popcountll(w);
+        return cnt;
+    }
+
+    // Build from a flat row-major buffer: bit set where pred(value) holds
+    template <class T, class Pred>
+    static BitGrid fromCells(const vector<T>& cells, int n, int m, Pred pred) {
+        BitGrid g(n, m);
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < m; c++)
+                if (pred(cells[(size_t)r * m + c])) g.set(r, c);
+        return g;
+    }
+};
+
+/*
+----------------------------------------------------
+GridBFS: queue-based multi-source BFS
+----------------------------------------------------
+run(sources, canEnter, onVisit):
+- sources  : flat cell indices (r * m + c), all at level 0
+- canEnter : canEnter(cell) -> may the BFS step onto it
+- onVisit  : onVisit(cell, level) called once per reached cell
+Returns the deepest level reached (-1 if no sources).
+
+The queue is a flat vector<uint32_t> processed level by
+level, so no {{row, col}, time} pairs are stored.
+----------------------------------------------------
+*/
+class GridBFS {
+public:
+    int n, m;
+    bool diagonal;            // 8-connectivity when true
+    BitGrid visited;
+
+    GridBFS(int n, int m, bool diagonal = false)
+        : n(n), m(m), diagonal(diagonal), visited(n, m) {}
+
+    template <class CanEnter, class OnVisit>
+    int run(const vector<uint32_t>& sources, CanEnter canEnter, OnVisit onVisit) {
+        static const int dr[] = {-1, 0, 1, 0, -1, -1, 1, 1};
+        static const int dc[] = {0, 1, 0, -1, -1, 1, -1, 1};
+        int dirs = diagonal ? 8 : 4;
+
+        queue_.clear();
+        for (uint32_t s : sources)
+            if (visited.testAndSet(s)) queue_.push_back(s);
+        if (queue_.empty()) return -1;
+
+        int level = 0;
+        size_t head = 0;
+        while (true) {
+            size_t levelEnd = queue_.size();
+            for (; head < levelEnd; head++) {
+                uint32_t cell = queue_[head];
+                onVisit(cell, level);
+                int r = cell / m, c = cell % m;
+                for (int d = 0; d < dirs; d++) {
+                    int nr = r + dr[d], nc = c + dc[d];
+                    if (nr < 0 || nr >= n || nc < 0 || nc >= m) continue;
+                    uint32_t next = (uint32_t)nr * m + nc;
+                    if (canEnter(next) && visited.testAndSet(next))
+                        queue_.push_back(next);
+                }
+            }
+            if (head == queue_.size()) break;
+            level++;
+        }
+        queue_.clear();
+        return level;
+    }
+
+private:
+    vector<uint32_t> queue_;
+};
+
+/*
+----------------------------------------------------
+bitsetFlood: word-parallel BFS
+----------------------------------------------------
+passable : cells the flood may spread into
+reached  : in = seed cells, out = every cell reached
+Each level computes for every active row r:
+    H        = F[r] | F[r] << 1 | F[r] >> 1   (8-conn) or F[r]
+    next[r]  = (H[r-1] | H[r+1] | F[r] << 1 | F[r] >> 1 | ...)
+               & passable[r] & ~reached[r]
+with carries between neighbouring words. Only rows inside
+the current frontier's [lo, hi] band (+1) are touched.
+Returns the number of levels it took (= BFS depth).
+----------------------------------------------------
+*/
+static inline void shiftOr(const uint64_t* src, uint64_t* dst, int W) {
+    // dst |= src << 1 | src >> 1   (bit c = column c)
+    for (int w = 0; w < W; w++) {
+        uint64_t left = src[w] << 1 | (w > 0 ? src[w - 1] >> 63 : 0);
+        uint64_t right = src[w] >> 1 | (w + 1 < W ? src[w + 1] << 63 : 0);
+        dst[w] |= left | right;
+    }
+}
+
+int bitsetFlood(const BitGrid& passable, BitGrid& reached, bool diagonal = false) {
+    int n = passable.n, W = passable.W;
+    BitGrid frontier = reached, horiz(n, passable.m), next(n, passable.m);
+
+    // last word of each row must not leak past column m-1
+    uint64_t tailMask = passable.m % 64 ? (1ULL << (passable.m % 64)) - 1 : ~0ULL;
+
+    int lo = 0, hi = n - 1, levels = 0;
+    while (true) {
+        // horizontal spread of the frontier (and its own bits for 8-conn)
+        for (int r = max(lo - 1, 0); r <= min(hi + 1, n - 1); r++)
+            fill(horiz.row(r), horiz.row(r) + W, 0);
+        for (int r = lo; r <= hi; r++) {
+            uint64_t* h = horiz.row(r);
+            const uint64_t* f = frontier.row(r);
+            if (diagonal) copy(f, f + W, h);
+            shiftOr(f, h, W);
+        }
+
+        int nlo = INT_MAX, nhi = -1;
+        for (int r = max(lo - 1, 0); r <= min(hi + 1, n - 1); r++) {
+            uint64_t* nx = next.row(r);
+            const uint64_t* up = r > 0 ? (diagonal ? horiz.row(r - 1) : frontier.row(r - 1)) : nullptr;
+            const uint64_t* down = r + 1 < n ? (diagonal ? horiz.row(r + 1) : frontier.row(r + 1)) : nullptr;
+            const uint64_t* h = horiz.row(r);
+            const uint64_t* p = passable.row(r);
+            uint64_t* seen = reached.row(r);
+            uint64_t any = 0;
+            for (int w = 0; w < W; w++) {
+                uint64_t v = h[w];
+                if (up && r - 1 >= lo && r - 1 <= hi) v |= up[w];
+                if (down && r + 1 >= lo && r + 1 <= hi) v |= down[w];
+                v &= p[w] & ~seen[w];
+                if (w == W - 1) v &= tailMask;
+                nx[w] = v;
+                seen[w] |= v;
+                any |= v;
+            }
+            if (any) nlo = min(nlo, r), nhi = max(nhi, r);
+        }
+
+        // clear old frontier band, install new one
+        for (int r = lo; r <= hi; r++) fill(frontier.row(r), frontier.row(r) + W, 0);
+        if (nhi < 0) break;
+        for (int r = nlo; r <= nhi; r++) copy(next.row(r), next.row(r) + W, frontier.row(r));
+        lo = nlo, hi = nhi;
+        levels++;
+    }
+    return levels;
+}
+
+/*
+====================================================
+The classic problems on top of the engine
+====================================================
+*/
+
+// Rotting oranges: 0 empty, 1 fresh, 2 rotten
+int orangeRottingFlat(const vector<uint8_t>& grid, int n, int m) {
+    GridBFS bfs(n, m);
+    vector<uint32_t> sources;
+    size_t fresh = 0;
+    for (size_t i = 0; i < grid.size(); i++) {
+        if (grid[i] == 2) sources.push_back(i);
+        if (grid[i] == 1) fresh++;
+    }
+    size_t rotted = 0;
+    int tm = 0;
+    bfs.run(sources, [&](uint32_t c) { return grid[c] == 1; },
+            [&](uint32_t c, int level) {
+                if (grid[c] == 1) rotted++;
+                tm = max(tm, level);
+            });
+    return rotted == fresh ? tm : -1;
+}
+
+// Same problem, word-parallel mode (no queue at all)
+int orangeRottingBitset(const vector<uint8_t>& grid, int n, int m) {
+    BitGrid fresh = BitGrid::fromCells(grid, n, m, [](uint8_t v) { return v == 1; });
+    BitGrid reached = BitGrid::fromCells(grid, n, m, [](uint8_t v) { return v == 2; });
+    size_t rottenAtStart = reached.count();
+    int tm = bitsetFlood(fresh, reached);
+    return reached.count() - rottenAtStart == fresh.count() ? tm : -1;
+}
+
+// Distance of nearest cell having 1 (written into dist)
+void nearestFlat(const vector<uint8_t>& grid, int n, int m, vector<int>& dist) {
+    GridBFS bfs(n, m);
+    vector<uint32_t> sources;
+    for (size_t i = 0; i < grid.size(); i++)
+        if (grid[i] == 1) sources.push_back(i);
+    dist.assign(grid.size(), -1);
+    bfs.run(sources, [](uint32_t) { return true; },
+            [&](uint32_t c, int level) { dist[c] = level; });
+}
+
+// Boundary cells of an n x m grid for which pred(cell) holds
+template <class Pred>
+vector<uint32_t> boundarySources(int n, int m, Pred pred) {
+    vector<uint32_t> src;
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < m; c++)
+            if ((r == 0 || c == 0 || r == n - 1 || c == m - 1) && pred((uint32_t)r * m + c))
+                src.push_back((uint32_t)r * m + c);
+    return src;
+}
+
+// Number of enclaves: land cells (1) that cannot reach the boundary
+int numberOfEnclavesFlat(const vector<uint8_t>& grid, int n, int m) {
+    GridBFS bfs(n, m);
+    auto land = [&](uint32_t c) { return grid[c] == 1; };
+    size_t total = count(grid.begin(), grid.end(), 1);
+    size_t escaped = 0;
+    bfs.run(boundarySources(n, m, land), land, [&](uint32_t, int) { escaped++; });
+    return total - escaped;
+}
+
+// Surrounded regions: every 'O' not connected to the border becomes 'X'
+void fillFlat(vector<char>& mat, int n, int m) {
+    GridBFS bfs(n, m);
+    auto open = [&](uint32_t c) { return mat[c] == 'O'; };
+    bfs.run(boundarySources(n, m, open), open, [](uint32_t, int) {});
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < m; c++)
+            if (mat[(size_t)r * m + c] == 'O' && !bfs.visited.test(r, c))
+                mat[(size_t)r * m + c] = 'X';
+}
+
+// Flood fill from (sr, sc) with newColor
+void floodFillFlat(vector<int>& image, int n, int m, int sr, int sc, int newColor) {
+    int iniColor = image[(size_t)sr * m + sc];
+    if (iniColor == newColor) return;
+    GridBFS bfs(n, m);
+    bfs.run({(uint32_t)sr * m + sc}, [&](uint32_t c) { return image[c] == iniColor; },
+            [&](uint32_t c, int) { image[c] = newColor; });
+}
+
+/*
+----------------------------------------------------
+Main Function
+----------------------------------------------------
+*/
+int main() {
+    int n = 3, m = 3;
+    vector<uint8_t> oranges = {
+        2, 1, 1,
+        1, 1, 0,
+        0, 1, 1
+    };
+    cout << "Minimum time to rot all oranges (queue) : " << orangeRottingFlat(oranges, n, m) << endl;
+    cout << "Minimum time to rot all oranges (bitset): " << orangeRottingBitset(oranges, n, m) << endl;
+
+    vector<uint8_t> binary = {
+        0, 0, 0,
+        0, 1, 0,
+        1, 0, 1
+    };
+    vector<int> dist;
+    nearestFlat(binary, n, m, dist);
+    cout << "Distance to nearest 1:" << endl;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < m; c++) cout << dist[r * m + c] << " ";
+        cout << endl;
+    }
+
+    int en = 4, em = 4;
+    vector<uint8_t> land = {
+        0, 0, 0, 0,
+        1, 0, 1, 0,
+        0, 1, 1, 0,
+        0, 0, 0, 0
+    };
+    cout << "Number of enclaves: " << numberOfEnclavesFlat(land, en, em) << endl;
+
+    vector<char> mat = {
+        'X', 'X', 'X', 'X',
+        'X', 'O', 'O', 'X',
+        'X', 'X', 'O', 'X',
+        'X', 'O', 'X', 'X'
+    };
+    fillFlat(mat, 4, 4);
+    cout << "Surrounded regions filled:" << endl;
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) cout << mat[r * 4 + c] << " ";
+        cout << endl;
+    }
+
+    vector<int> image = {
+        1, 1, 1,
+        1, 1, 0,
+        1, 0, 1
+    };
+    floodFillFlat(image, 3, 3, 1, 1, 2);
+    cout << "Flood filled image:" << endl;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) cout << image[r * 3 + c] << " ";
+        cout << endl;
+    }
+
+    // 8-connectivity: a diagonal chain is one region
+    vector<uint8_t> diag = {
+        2, 0, 0,
+        0, 1, 0,
+        0, 0, 1
+    };
+    GridBFS bfs8(3, 3, true);
+    vector<uint32_t> src = {0};
+    int depth = bfs8.run(src, [&](uint32_t c) { return diag[c] == 1; }, [](uint32_t, int) {});
+    cout << "8-connected rot time on diagonal chain: " << depth << endl;
+
+    return 0;
+}
+
+/*
+====================================================
+COMPLEXITY:
+====================================================
+Let N = rows, M = columns
+
+Queue mode (GridBFS::run):
+- Time : O(N * M * k), k = 4 or 8 neighbours
+- Space: N * M / 8 bytes visited + queue of uint32_t
+
+Bitset mode (bitsetFlood):
+- Time : O(D * rows_in_band * M / 64), D = BFS depth
+  -> best for wide, shallow floods (masks, boundary fills)
+- Space: 4 bit-planes of N * M bits
+
+vs. vector<vector<int>> grid + vis:
+- 8 bytes per cell -> 1 byte per cell (grid) + 1 bit (vis)
+====================================================
+*/
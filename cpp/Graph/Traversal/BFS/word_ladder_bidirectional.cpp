@@ -0,0 +1,317 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+--------------------------------------------------------
+Problem: Word Ladder I & II on a large dictionary
+         (bidirectional BFS over wildcard buckets)
+--------------------------------------------------------
+word_Ladder_I.cpp / word_ladderII.cpp / word_ladderII_optimal.cpp
+generate neighbours by trying 'a'..'z' at every position and
+probing an unordered_set<string>. Every probe builds / hashes a
+string, which dominates once the dictionary has ~10^6 words.
+
+Approach:
+1️⃣ Intern every dictionary word as an integer id (0..N-1).
+2️⃣ Pre-index the dictionary into wildcard buckets:
+   "hot" belongs to "*ot", "h*t" and "ho*".
+   A bucket key is a 64-bit polynomial hash of the word with
+   position i treated as '*'. All L keys of a word are computed
+   in O(L) by subtracting the character's contribution from the
+   full hash, so no pattern string is ever built.
+   Buckets are stored CSR-style (bucketStart + bucketWords).
+3️⃣ Neighbours of word u = members of u's L buckets. Each member
+   is verified with a prefix/suffix compare (guards against hash
+   collisions) - no allocation, no hashing during the search.
+4️⃣ Bidirectional BFS: always expand the smaller frontier, stop
+   at the first level where the two searches meet.
+5️⃣ Ladder II: while expanding, record the forward edges between
+   consecutive levels (a parent DAG). After the meeting level,
+   DFS from beginWord along the DAG (with dead-end memo) to
+   enumerate every shortest sequence.
+
+beginWord does not need to be in the dictionary: its bucket keys
+are looked up in the sorted key array with binary search and it
+gets the virtual id N.
+--------------------------------------------------------
+*/
+
+class WordLadderIndex {
+public:
+    explicit WordLadderIndex(const vector<string>& wordList) {
+        words = wordList;
+        sort(words.begin(), words.end());
+        words.erase(unique(words.begin(), words.end()), words.end());
+
+        int n = words.size();
+        wordKeyStart.assign(n + 1, 0);
+        for (int i = 0; i < n; i++)
+            wordKeyStart[i + 1] = wordKeyStart[i] + words[i].size();
+
+        // (key, wordId) for every (word, position)
+        vector<pair<uint64_t, int>> entries;
+        entries.reserve(wordKeyStart[n]);
+        vector<uint64_t> keys;
+        for (int id = 0; id < n; id++) {
+            patternKeys(words[id], keys);
+            for (uint64_t k : keys) entries.push_back({k, id});
+        }
+        sort(entries.begin(), entries.end());
+
+        // CSR buckets
+        bucketWords.resize(entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (i == 0 || entries[i].first != entries[i - 1].first) {
+                bucketKeys.push_back(entries[i].first);
+                bucketStart.push_back(i);
+            }
+            bucketWords[i] = entries[i].second;
+        }
+        bucketStart.push_back(entries.size());
+
+        // bucket of each (word, position)
+        wordBucket.resize(wordKeyStart[n]);
+        for (int id = 0; id < n; id++) {
+            patternKeys(words[id], keys);
+            for (size_t i = 0; i < keys.size(); i++)
+                wordBucket[wordKeyStart[id] + i] = findBucket(keys[i]);
+        }
+    }
+
+    // Number of words in the shortest transformation sequence, 0 if none
+    int ladderLength(const string& beginWord, const string& endWord) {
+        int s, t;
+        if (!prepareQuery(beginWord, endWord, s, t)) return 0;
+        if (s == t) return 1;
+
+        int total = words.size() + 1;
+        // side[v]: 0 = unseen, 1 = reached from begin, 2 = reached from end
+        vector<char> side(total, 0);
+        vector<int> dist(total, 0);
+        vector<int> front = {s}, back = {t}, next;
+        side[s] = 1;
+        side[t] = 2;
+        char frontSide = 1;
+
+        while (!front.empty() && !back.empty()) {
+            if (front.size() > back.size()) {
+                swap(front, back);
+                frontSide = 3 - frontSide;
+            }
+            next.clear();
+            int best = INT_MAX;
+            for (int u : front) {
+                forEachNeighbor(u, [&](int v) {
+                    if (side[v] == 3 - frontSide) {
+                        best = min(best, dist[u] + 1 + dist[v]);
+                    } else if (side[v] == 0) {
+                        side[v] = frontSide;
+                        dist[v] = dist[u] + 1;
+                        next.push_back(v);
+                    }
+                });
+            }
+            if (best != INT_MAX) return best + 1;  // edges -> words
+            swap(front, next);
+        }
+        return 0;
+    }
+
+    // All shortest transformation sequences from beginWord to endWord
+    vector<vector<string>> findLadders(const string& beginWord, const string& endWord) {
+        vector<vector<string>> ans;
+        int s, t;
+        if (!prepareQuery(beginWord, endWord, s, t)) return ans;
+        if (s == t) return {{beginWord}};
+
+        int total = words.size() + 1;
+        vector<char> visited(total, 0);
+        vector<char> inFront(total, 0), inBack(total, 0), inNext(total, 0);
+        vector<int> front = {s}, back = {t}, next;
+        visited[s] = visited[t] = 1;
+        inFront[s] = inBack[t] = 1;
+        bool flipped = false;   // true when "front" is the search from endWord
+        bool found = false;
+
+        vector<pair<int, int>> dagEdges;   // forward edges u -> v (towards endWord)
+        vector<pair<int, int>> levelEdges;
+
+        while (!front.empty() && !back.empty() && !found) {
+            if (front.size() > back.size()) {
+                swap(front, back);
+                swap(inFront, inBack);
+                flipped = !flipped;
+            }
+            next.clear();
+            levelEdges.clear();
+            for (int u : front) {
+                forEachNeighbor(u, [&](int v) {
+                    if (inBack[v]) {
+                        if (!found) levelEdges.clear();  // only meeting edges matter now
+                        found = true;
+                    } else if (found || visited[v]) {
+                        return;
+                    } else if (!inNext[v]) {
+                        inNext[v] = 1;
+                        next.push_back(v);
+                    }
+                    if (flipped) levelEdges.push_back({v, u});
+                    else levelEdges.push_back({u, v});
+                });
+            }
+            dagEdges.insert(dagEdges.end(), levelEdges.begin(), levelEdges.end());
+
+            for (int u : front) inFront[u] = 0;
+            for (int v : next) {
+                inNext[v] = 0;
+                visited[v] = 1;
+                inFront[v] = 1;
+            }
+            swap(front, next);
+        }
+        if (!found) return ans;
+
+        // parent DAG in CSR form (children of each node)
+        vector<int> childStart(total + 1, 0), children(dagEdges.size());
+        for (auto& e : dagEdges) childStart[e.first + 1]++;
+        for (int i = 0; i < total; i++) childStart[i + 1] += childStart[i];
+        vector<int> fill(childStart.begin(), childStart.end() - 1);
+        for (auto& e : dagEdges) children[fill[e.first]++] = e.second;
+
+        // state: 0 = unknown, 1 = reaches endWord, 2 = dead end
+        vector<char> state(total, 0);
+        state[t] = 1;
+        vector<int> path = {s};
+        collectPaths(s, t, childStart, children, state, path, ans);
+        return ans;
+    }
+
+private:
+    vector<string> words;                 // interned dictionary, id -> word
+    vector<int> wordKeyStart;             // offset of word's keys in wordBucket
+    vector<int> wordBucket;               // bucket of (word, position)
+    vector<uint64_t> bucketKeys;          // sorted unique pattern keys
+    vector<int> bucketStart, bucketWords; // CSR bucket -> word ids
+
+    string queryWord;                     // beginWord when it is not in the dictionary
+    vector<int> queryBucket;              // its buckets (-1 = empty pattern)
+
+    static constexpr uint64_t BASE = 1000003ULL;
+
+    // key of word with position i as '*': H(word) - word[i] * BASE^(L-1-i)
+    static void patternKeys(const string& w, vector<uint64_t>& keys) {
+        int L = w.size();
+        keys.resize(L);
+        uint64_t h = 0;
+        for (int i = 0; i < L; i++) h = h * BASE + (unsigned char)w[i] + 1;
+        uint64_t pw = 1;
+        for (int i = L - 1; i >= 0; i--) {
+            uint64_t k = h - ((unsigned char)w[i] + 1) * pw;
+            keys[i] = (k ^ (uint64_t)L * 0x9E3779B97F4A7C15ULL) + i;
+            pw *= BASE;
+        }
+    }
+
+    int findBucket(uint64_t key) const {
+        auto it = lower_bound(bucketKeys.begin(), bucketKeys.end(), key);
+        if (it == bucketKeys.end() || *it != key) return -1;
+        return it - bucketKeys.begin();
+    }
+
+    int idOf(const string& w) const {
+        auto it = lower_bound(words.begin(), words.end(), w);
+        if (it == words.end() || *it != w) return -1;
+        return it - words.begin();
+    }
+
+    const string& wordOf(int id) const {
+        return id == (int)words.size() ? queryWord : words[id];
+    }
+
+    // true if a and b differ only at position pos
+    static bool differsOnlyAt(const string& a, const string& b, int pos) {
+        if (a.size() != b.size() || a[pos] == b[pos]) return false;
+        return memcmp(a.data(), b.data(), pos) == 0 &&
+               memcmp(a.data() + pos + 1, b.data() + pos + 1, a.size() - pos - 1) == 0;
+    }
+
+    template <class F>
+    void forEachNeighbor(int u, F&& visit) const {
+        const string& w = wordOf(u);
+        bool isQuery = u == (int)words.size();
+        for (int i = 0; i < (int)w.size(); i++) {
+            int b = isQuery ? queryBucket[i] : wordBucket[wordKeyStart[u] + i];
+            if (b < 0) continue;
+            for (int k = bucketStart[b]; k < bucketStart[b + 1]; k++) {
+                int v = bucketWords[k];
+                if (v != u && differsOnlyAt(w, words[v], i)) visit(v);
+            }
+        }
+    }
+
+    bool prepareQuery(const string& beginWord, const string& endWord, int& s, int& t) {
+        t = idOf(endWord);
+        if (t < 0 || beginWord.size() != endWord.size()) return false;
+        s = idOf(beginWord);
+        if (s < 0) {
+            s = words.size();
+            queryWord = beginWord;
+            vector<uint64_t> keys;
+            patternKeys(beginWord, keys);
+            queryBucket.resize(keys.size());
+            for (size_t i = 0; i < keys.size(); i++) queryBucket[i] = findBucket(keys[i]);
+        }
+        return true;
+    }
+
+    bool collectPaths(int u, int t, const vector<int>& childStart, const vector<int>& children,
+                      vector<char>& state, vector<int>& path, vector<vector<string>>& ans) {
+        if (u == t) {
+            vector<string> seq;
+            for (int id : path) seq.push_back(wordOf(id));
+            ans.push_back(seq);
+            return true;
+        }
+        bool reaches = false;
+        for (int k = childStart[u]; k < childStart[u + 1]; k++) {
+            int v = children[k];
+            if (state[v] == 2) continue;
+            path.push_back(v);
+            if (collectPaths(v, t, childStart, children, state, path, ans))
+                reaches = true;
+            path.pop_back();
+        }
+        state[u] = reaches ? 1 : 2;
+        return reaches;
+    }
+};
+
+// --------------------------------------------------------
+// Main function to test
+// --------------------------------------------------------
+int main() {
+    vector<string> wordList = {"hot", "dot", "dog", "lot", "log", "cog"};
+    WordLadderIndex index(wordList);
+
+    cout << "Ladder length hit -> cog: " << index.ladderLength("hit", "cog") << "\n";
+    cout << "Ladder length hit -> cat: " << index.ladderLength("hit", "cat") << "\n";
+
+    vector<vector<string>> result = index.findLadders("hit", "cog");
+    cout << "All shortest transformation sequences:\n";
+    for (auto& path : result) {
+        for (int i = 0; i < (int)path.size(); i++) {
+            cout << path[i];
+            if (i != (int)path.size() - 1) cout << " -> ";
+        }
+        cout << "\n";
+    }
+    return 0;
+}
+
+// | Phase                 | Time                         | Space      |
+// | --------------------- | ---------------------------- | ---------- |
+// | Build index           | O(N * L * log(N * L))        | O(N * L)   |
+// | Neighbour enumeration | O(L * bucket size * L)       | O(1)       |
+// | Bidirectional BFS     | ~O(b^(d/2)) instead of b^d   | O(N)       |
+// | Ladder II paths       | O(DAG edges + P * d)         | O(N + DAG) |
+// N = dictionary size, L = word length, d = ladder length, P = number of paths
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../../../fast_io.h"
 using namespace std;
 
 /*
@@ -20,15 +21,18 @@ void dfs(int node, vector<int> adj[], int vis[], vector<int> &ls) {
 Main function to demonstrate DFS traversal
 */
 int main() {
+    FastReader in;
+    FastWriter out;
+
     int n, m;
-    cin >> n >> m; // n = number of vertices, m = number of edges
+    in >> n >> m; // n = number of vertices, m = number of edges
 
     vector<int> adj[n + 1];
 
     // Building adjacency list
     for (int i = 0; i < m; i++) {
         int u, v;
-        cin >> u >> v;
+        in >> u >> v;
         adj[u].push_back(v);
         adj[v].push_back(u); // remove this line for directed graph
     }
@@ -39,11 +43,11 @@ int main() {
     // Start DFS from node 0
     dfs(0, adj, vis, dfsResult);
 
-    cout << "DFS Traversal: ";
+    out << "DFS Traversal: ";
     for (auto node : dfsResult) {
-        cout << node << " ";
+        out << node << " ";
     }
-    cout << endl;
+    out << '\n';
 
     return 0;
 }
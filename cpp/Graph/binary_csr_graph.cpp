@@ -0,0 +1,496 @@
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/*
+--------------------------------------------
+Binary CSR graph file + memory-mapped loading
+--------------------------------------------
+implementation_graph.cpp and every driver in Graph/ read
+
+    V E
+    u v [w]      (E lines)
+
+with cin >> and build vector<int> adj[V]. On a graph with billions of
+edges, parsing that text takes far longer than BFS / Dijkstra
+themselves, and is repeated on every run.
+
+1️⃣ Convert the text edge list ONCE into a binary CSR file:
+
+    offset  size            field
+    0       8               magic "CSRGRPH1"
+    8       4               version (1)
+    12      4               flags: bit 0 directed, bit 1 weighted
+    16      8               n  (vertices, <= INT_MAX)
+    24      8               m  (stored arcs; undirected edges count twice)
+    32      8 * (n + 1)     offsets[u] .. offsets[u+1] = arcs of u
+    ...     4 * m           targets (uint32)
+    ...     4 * m           weights (int32, only if weighted)
+
+   Native byte order (little-endian on x86 / ARM). The converter maps
+   both files: pass 1 counts degrees straight into the offsets array,
+   pass 2 places every arc. Nothing of size E is held on the heap —
+   the output pages are written in place.
+
+2️⃣ Load with mmap: check the header, point at the three arrays.
+   No parsing, no allocation, O(1): header fields, file size ==
+   layout size, offsets[0] == 0 and offsets[n] == m. Pages are
+   faulted in by the OS on first touch, so BFS / Dijkstra / SCC /
+   MST start immediately.
+   Files from elsewhere: load(path, true) also scans every offset
+   (monotone) and every target (< n) once — O(V + E) — so a corrupt
+   file is rejected instead of making the algorithms read outside
+   the mapping.
+--------------------------------------------
+*/
+
+struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t n, m;
+};
+static_assert(sizeof(GraphFileHeader) == 32, "header layout");
+
+const char GRAPH_MAGIC[8] = {'C', 'S', 'R', 'G', 'R', 'P', 'H', '1'};
+const uint32_t GRAPH_DIRECTED = 1, GRAPH_WEIGHTED = 2;
+
+// Byte layout shared by the writer and the loader
+struct GraphFileLayout {
+    uint64_t offsets, targets, weights, total;
+
+    // vertices are ints; m <= 2^60 keeps every byte count below 2^64
+    static bool fits(uint64_t n, uint64_t m) { return n <= INT_MAX && m <= (1ULL << 60); }
+
+    GraphFileLayout(uint64_t n, uint64_t m, bool weighted) {
+        offsets = sizeof(GraphFileHeader);
+        targets = offsets + 8 * (n + 1);
+        weights = targets + 4 * m;
+        total = weights + (weighted ? 4 * m : 0);
+    }
+};
+
+/*
+--------------------------------------------
+Read-only memory-mapped file (RAII)
+--------------------------------------------
+*/
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    bool open(const string& path) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED) {
+                base = (const char*)p;
+                len = st.st_size;
+            }
+        }
+        ::close(fd);
+        return base != nullptr;
+    }
+
+    void close() {
+        if (base) munmap((void*)base, len);
+        base = nullptr;
+        len = 0;
+    }
+
+    const char* data() const { return base; }
+    size_t size() const { return len; }
+
+private:
+    const char* base = nullptr;
+    size_t len = 0;
+};
+
+/*
+--------------------------------------------
+1️⃣ Converter: text edge list → binary CSR
+--------------------------------------------
+*/
+class EdgeListConverter {
+public:
+    // Converts "V E / u v [w]" text; weighted expects a third number per edge
+    bool convert(const string& textPath, const string& binPath, bool directed, bool weighted) {
+        MappedFile text;
+        if (!text.open(textPath)) return fail("cannot map " + textPath);
+        const char* begin = text.data();
+        const char* end = begin + text.size();
+
+        const char* p = begin;
+        long long n, e;
+        if (nextInt(p, end, n) != 1 || nextInt(p, end, e) != 1 || n < 0 || e < 0)
+            return fail("bad header line");
+        uint64_t m = directed ? e : 2 * (uint64_t)e;
+        if (!GraphFileLayout::fits(n, m)) return fail("graph too large (V <= INT_MAX)");
+        if ((uint64_t)e > text.size()) return fail("more edges than the text can hold");
+        GraphFileLayout layout(n, m, weighted);
+
+        int fd = ::open(binPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return fail("cannot create " + binPath);
+        if (ftruncate(fd, layout.total) != 0) {
+            ::close(fd);
+            return fail("cannot size " + binPath);
+        }
+        void* out = mmap(nullptr, layout.total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (out == MAP_FAILED) return fail("cannot map " + binPath);
+        char* base = (char*)out;
+
+        GraphFileHeader* h = (GraphFileHeader*)base;
+        memcpy(h->magic, GRAPH_MAGIC, 8);
+        h->version = 1;
+        h->flags = (directed ? GRAPH_DIRECTED : 0) | (weighted ? GRAPH_WEIGHTED : 0);
+        h->n = n;
+        h->m = m;
+        uint64_t* offsets = (uint64_t*)(base + layout.offsets);
+        uint32_t* targets = (uint32_t*)(base + layout.targets);
+        int32_t* weights = (int32_t*)(base + layout.weights);
+
+        // pass 1: degrees (ftruncate zero-fills, so offsets start at 0)
+        const char* edges = p;
+        bool ok = forEachEdge(edges, end, e, n, weighted, [&](long long u, long long v, long long) {
+            offsets[u + 1]++;
+            if (!directed) offsets[v + 1]++;
+        });
+
+        // pass 2: place arcs; offsets[u] is used as u's write cursor
+        if (ok) {
+            for (long long u = 0; u < n; u++) offsets[u + 1] += offsets[u];
+            auto place = [&](long long u, long long v, long long w) {
+                uint64_t k = offsets[u]++;
+                targets[k] = v;
+                if (weighted) weights[k] = w;
+            };
+            forEachEdge(edges, end, e, n, weighted, [&](long long u, long long v, long long w) {
+                place(u, v, w);
+                if (!directed) place(v, u, w);
+            });
+            // cursors now hold the END of each row; shift back to starts
+            for (long long u = n; u > 0; u--) offsets[u] = offsets[u - 1];
+            offsets[0] = 0;
+        }
+
+        munmap(out, layout.total);
+        if (!ok) unlink(binPath.c_str());
+        return ok;
+    }
+
+    const string& lastError() const { return error; }
+
+private:
+    string error;
+
+    bool fail(const string& why) {
+        error = why;
+        return false;
+    }
+
+    static bool isSeparator(char c) { return isspace((unsigned char)c) || c == ','; }
+
+    // Next integer token; only whitespace and ',' separate tokens.
+    // 1 = ok, 0 = end of input, -1 = non-numeric token ("1.5", "x", "-").
+    // Absurdly long numbers saturate, so the range checks reject them.
+    static int nextInt(const char*& p, const char* end, long long& x) {
+        while (p < end && isSeparator(*p)) p++;
+        if (p == end) return 0;
+        bool neg = *p == '-';
+        if (neg) p++;
+        if (p == end || !isdigit((unsigned char)*p)) return -1;
+        x = 0;
+        for (; p < end && isdigit((unsigned char)*p); p++)
+            x = x > LLONG_MAX / 20 ? LLONG_MAX / 2 : x * 10 + (*p - '0');
+        if (p < end && !isSeparator(*p)) return -1;
+        if (neg) x = -x;
+        return 1;
+    }
+
+    template <class F>
+    bool forEachEdge(const char* p, const char* end, long long e, long long n, bool weighted, F f) {
+        for (long long i = 0; i < e; i++) {
+            long long u, v, w = 0;
+            int st = 1;
+            auto next = [&](long long& x) { return (st = nextInt(p, end, x)) == 1; };
+            if (!next(u) || !next(v) || (weighted && !next(w)))
+                return fail("edge " + to_string(i) + (st < 0 ? ": non-numeric token" : ": unexpected end of input"));
+            if (u < 0 || u >= n || v < 0 || v >= n)
+                return fail("edge " + to_string(i) + ": vertex out of range");
+            if (w < INT32_MIN || w > INT32_MAX)
+                return fail("edge " + to_string(i) + ": weight does not fit in int32");
+            f(u, v, w);
+        }
+        return true;
+    }
+};
+
+/*
+--------------------------------------------
+2️⃣ Loader: the mapped file IS the graph
+--------------------------------------------
+*/
+class MappedGraph {
+public:
+    // validate = full O(V + E) scan, for files that did not come from
+    // EdgeListConverter on this machine
+    bool load(const string& path, bool validate = false) {
+        if (!file.open(path)) return fail("cannot map " + path);
+        if (file.size() < sizeof(GraphFileHeader)) return fail("file too small");
+        const GraphFileHeader* h = (const GraphFileHeader*)file.data();
+        if (memcmp(h->magic, GRAPH_MAGIC, 8) != 0 || h->version != 1)
+            return fail("not a CSR graph file");
+        if ((h->flags & ~(GRAPH_DIRECTED | GRAPH_WEIGHTED)) || !GraphFileLayout::fits(h->n, h->m))
+            return fail("bad header");
+        GraphFileLayout layout(h->n, h->m, h->flags & GRAPH_WEIGHTED);
+        if (file.size() != layout.total) return fail("file size does not match header");
+
+        n = h->n;
+        m = h->m;
+        flags = h->flags;
+        offsets = (const uint64_t*)(file.data() + layout.offsets);
+        targets = (const uint32_t*)(file.data() + layout.targets);
+        weights = weighted() ? (const int32_t*)(file.data() + layout.weights) : nullptr;
+
+        if (offsets[0] != 0 || offsets[n] != m) return fail("offsets do not match arc count");
+        if (!validate) return true;
+
+        // every arc the algorithms follow must stay inside the mapping
+        for (int u = 0; u < n; u++)
+            if (offsets[u] > offsets[u + 1]) return fail("offsets not monotone");
+        for (uint64_t k = 0; k < m; k++)
+            if (targets[k] >= (uint32_t)n) return fail("arc target out of range");
+        return true;
+    }
+
+    int vertices() const { return n; }
+    uint64_t arcs() const { return m; }
+    bool directed() const { return flags & GRAPH_DIRECTED; }
+    bool weighted() const { return flags & GRAPH_WEIGHTED; }
+
+    // arcs of u are k in [begin(u), end(u))
+    uint64_t begin(int u) const { return offsets[u]; }
+    uint64_t end(int u) const { return offsets[u + 1]; }
+    int target(uint64_t k) const { return targets[k]; }
+    int weight(uint64_t k) const { return weights ? weights[k] : 1; }
+
+    const string& lastError() const { return error; }
+
+private:
+    MappedFile file;
+    int n = 0;
+    uint64_t m = 0;
+    uint32_t flags = 0;
+    const uint64_t* offsets = nullptr;
+    const uint32_t* targets = nullptr;
+    const int32_t* weights = nullptr;
+    string error;
+
+    bool fail(const string& why) {
+        error = why;
+        file.close();
+        return false;
+    }
+};
+
+/*
+--------------------------------------------
+Algorithms straight on the mapped CSR
+--------------------------------------------
+*/
+
+// BFS order from src (same as bfsofgraph, flat queue)
+vector<int> bfsMapped(const MappedGraph& g, int src) {
+    vector<char> vis(g.vertices(), 0);
+    vector<int> q = {src};
+    vis[src] = 1;
+    for (size_t head = 0; head < q.size(); head++) {
+        int node = q[head];
+        for (uint64_t k = g.begin(node); k < g.end(node); k++) {
+            int it = g.target(k);
+            if (!vis[it]) {
+                vis[it] = 1;
+                q.push_back(it);
+            }
+        }
+    }
+    return q;
+}
+
+// Dijkstra with a min-heap; -1 = unreachable
+vector<long long> dijkstraMapped(const MappedGraph& g, int src) {
+    vector<long long> dist(g.vertices(), LLONG_MAX);
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>> pq;
+    dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        auto [dis, node] = pq.top();
+        pq.pop();
+        if (dis > dist[node]) continue;
+        for (uint64_t k = g.begin(node); k < g.end(node); k++) {
+            int adjNode = g.target(k);
+            if (dis + g.weight(k) < dist[adjNode]) {
+                dist[adjNode] = dis + g.weight(k);
+                pq.push({dist[adjNode], adjNode});
+            }
+        }
+    }
+    for (auto& d : dist)
+        if (d == LLONG_MAX) d = -1;
+    return dist;
+}
+
+// Number of SCCs. Tarjan instead of Kosaraju: Kosaraju needs the
+// transposed graph, i.e. a second copy of all E arcs in memory.
+// Iterative, so deep graphs cannot overflow the call stack.
+int sccMapped(const MappedGraph& g) {
+    int n = g.vertices(), timer = 0, scc = 0;
+    vector<int> tin(n, -1), low(n), st;
+    vector<char> onStack(n, 0);
+    vector<pair<int, uint64_t>> call;   // {node, next arc to look at}
+
+    for (int s = 0; s < n; s++) {
+        if (tin[s] != -1) continue;
+        call.push_back({s, g.begin(s)});
+        tin[s] = low[s] = timer++;
+        st.push_back(s);
+        onStack[s] = 1;
+        while (!call.empty()) {
+            auto& [node, k] = call.back();
+            if (k < g.end(node)) {
+                int it = g.target(k++);
+                if (tin[it] == -1) {
+                    tin[it] = low[it] = timer++;
+                    st.push_back(it);
+                    onStack[it] = 1;
+                    call.push_back({it, g.begin(it)});
+                } else if (onStack[it]) {
+                    low[node] = min(low[node], tin[it]);
+                }
+                continue;
+            }
+            int done = node;
+            call.pop_back();
+            if (!call.empty()) low[call.back().first] = min(low[call.back().first], low[done]);
+            if (low[done] == tin[done]) {   // done is the root of an SCC
+                scc++;
+                int x;
+                do {
+                    x = st.back();
+                    st.pop_back();
+                    onStack[x] = 0;
+                } while (x != done);
+            }
+        }
+    }
+    return scc;
+}
+
+// Prim's MST weight over every component (undirected graphs)
+long long mstMapped(const MappedGraph& g) {
+    int n = g.vertices();
+    vector<char> vis(n, 0);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    long long sum = 0;
+    for (int s = 0; s < n; s++) {
+        if (vis[s]) continue;
+        pq.push({0, s});
+        while (!pq.empty()) {
+            auto [wt, node] = pq.top();
+            pq.pop();
+            if (vis[node]) continue;
+            vis[node] = 1;
+            sum += wt;
+            for (uint64_t k = g.begin(node); k < g.end(node); k++)
+                if (!vis[g.target(k)]) pq.push({g.weight(k), g.target(k)});
+        }
+    }
+    return sum;
+}
+
+/*
+--------------------------------------------
+Main Function
+--------------------------------------------
+    ./a.out convert edges.txt graph.bin [directed] [weighted]
+    ./a.out info graph.bin [verify]
+    ./a.out              (demo on a small temporary graph)
+*/
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && string(argv[1]) == "convert") {
+        bool directed = false, weighted = false;
+        for (int i = 4; i < argc; i++) {
+            directed |= string(argv[i]) == "directed";
+            weighted |= string(argv[i]) == "weighted";
+        }
+        EdgeListConverter conv;
+        if (!conv.convert(argv[2], argv[3], directed, weighted)) {
+            cerr << "convert failed: " << conv.lastError() << endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (argc >= 3 && string(argv[1]) == "info") {
+        MappedGraph g;
+        if (!g.load(argv[2], argc >= 4 && string(argv[3]) == "verify")) {
+            cerr << "load failed: " << g.lastError() << endl;
+            return 1;
+        }
+        cout << "V = " << g.vertices() << ", arcs = " << g.arcs()
+             << (g.directed() ? ", directed" : ", undirected")
+             << (g.weighted() ? ", weighted" : "") << endl;
+        return 0;
+    }
+
+    string dir = "/tmp/";
+    string txt = dir + "csr_demo.txt", bin = dir + "csr_demo.bin";
+    ofstream(txt) << "6 7\n0 1 4\n0 2 1\n2 1 2\n1 3 5\n2 3 8\n3 4 3\n4 5 1\n";
+
+    EdgeListConverter conv;
+    MappedGraph g;
+    if (!conv.convert(txt, bin, false, true) || !g.load(bin)) {
+        cerr << conv.lastError() << g.lastError() << endl;
+        return 1;
+    }
+    cout << "BFS Traversal:";
+    for (int x : bfsMapped(g, 0)) cout << " " << x;
+    cout << "\nDijkstra from 0:";
+    for (long long d : dijkstraMapped(g, 0)) cout << " " << d;
+    cout << "\nMST weight: " << mstMapped(g) << endl;
+
+    // same edges as a directed graph: 0->1, 0->2, 2->1, ... no cycles
+    MappedGraph dg;
+    if (!conv.convert(txt, bin, true, true) || !dg.load(bin)) {
+        cerr << conv.lastError() << dg.lastError() << endl;
+        return 1;
+    }
+    cout << "SCCs (directed): " << sccMapped(dg) << endl;
+
+    unlink(txt.c_str());
+    unlink(bin.c_str());
+    return 0;
+}
+
+/*
+--------------------------------------------
+Time Complexity:
+    - convert : O(size of text) twice, O(V + E) writes
+    - load    : O(1) (header + size check; pages load on first touch),
+                O(V + E) with validate = true
+    - BFS O(V + E), Dijkstra O(E log V), SCC O(V + E), MST O(E log E)
+Space Complexity:
+    - convert : O(1) heap; output file is V * 8 + E * 4 (+ E * 4) bytes
+    - load    : O(1) heap; the graph lives in the page cache
+    - algorithms: O(V) working arrays (+ heap for Dijkstra / Prim)
+--------------------------------------------
+*/
@@ -1,9 +1,12 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 int main() {
+    FastReader in;
+
     int n, m;
-    cin >> n >> m; // n = number of nodes, m = number of edges
+    in >> n >> m; // n = number of nodes, m = number of edges
 
     // -------------------------------
     // 1️⃣ Adjacency Matrix (Unweighted)
@@ -12,7 +15,7 @@ int main() {
 
     for (int i = 0; i < m; i++) {
         int u, v;
-        cin >> u >> v;
+        in >> u >> v;
 
         // Undirected graph
         adjMatrix[u][v] = 1;
@@ -28,7 +31,7 @@ int main() {
 
     for (int i = 0; i < m; i++) {
         int u, v;
-        cin >> u >> v;
+        in >> u >> v;
 
         // Undirected graph
         adjList[u].push_back(v);
@@ -44,7 +47,7 @@ int main() {
 
     for (int i = 0; i < m; i++) {
         int u, v, wt;
-        cin >> u >> v >> wt;
+        in >> u >> v >> wt;
 
         // Undirected graph
         adjMatrixWt[u][v] = wt;
@@ -60,7 +63,7 @@ int main() {
 
     for (int i = 0; i < m; i++) {
         int u, v, wt;
-        cin >> u >> v >> wt;
+        in >> u >> v >> wt;
 
         // Undirected graph
         adjListWt[u].push_back({v, wt});
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 /*
@@ -112,8 +113,11 @@ Info query(int ind, int low, int high, int l, int r, vector<Info> &seg) {
  * - Segment Tree: O(4n)
  */
 void solve() {
+    FastReader in;
+    FastWriter out;
+
     string s;
-    cin >> s;
+    in >> s;
 
     int n = s.size();
     vector<Info> seg(4 * n);
@@ -121,11 +125,11 @@ void solve() {
     build(0, 0, n - 1, s, seg);
 
     int q;
-    cin >> q;
+    in >> q;
 
     while (q--) {
         int l, r;
-        cin >> l >> r;
+        in >> l >> r;
 
         // Convert to 0-based indexing
         l--;
@@ -134,14 +138,11 @@ void solve() {
         Info ans = query(0, 0, n - 1, l, r, seg);
 
         // Each matched pair contributes 2 characters
-        cout << ans.full * 2 << "\n";
+        out << ans.full * 2 << "\n";
     }
 }
 
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-
     solve();
     return 0;
 }
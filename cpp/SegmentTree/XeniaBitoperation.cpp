@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 /*
@@ -72,15 +73,18 @@ void update(int ind, int low, int high, int seg[], bool orr, int i, int val) {
 }
 
 int main() {
+    FastReader in;
+    FastWriter out;
+
     int n, q;
-    cin >> n >> q;
+    in >> n >> q;
 
     // Size of array = 2^n
     int el = 1 << n;
 
     int arr[el];
     for (int i = 0; i < el; i++)
-        cin >> arr[i];
+        in >> arr[i];
 
     // Segment tree size (safe allocation)
     int seg[4 * el];
@@ -97,13 +101,13 @@ int main() {
     // Process queries
     while (q--) {
         int i, val;
-        cin >> i >> val;
+        in >> i >> val;
 
         i--; // Convert to 0-based indexing
 
         // Update and print result at root
         update(0, 0, el - 1, seg, orr, i, val);
-        cout << seg[0] << '\n';
+        out << seg[0] << '\n';
     }
 }
 
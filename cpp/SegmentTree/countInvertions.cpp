@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 /*
@@ -125,14 +126,17 @@ O(N)
 */
 
 void solve() {
+    FastReader in;
+    FastWriter out;
+
     int n;
-    cin >> n;
+    in >> n;
 
     vector<int> arr(n);
     int mx = 0;
 
     for (int i = 0; i < n; i++) {
-        cin >> arr[i];
+        in >> arr[i];
         mx = max(mx, arr[i]);
     }
 
@@ -155,13 +159,10 @@ void solve() {
             cnt += st.query(0, 0, mx, 0, arr[i] - 1);
     }
 
-    cout << cnt << endl;
+    out << cnt << '\n';
 }
 
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-
     solve();
     return 0;
 }
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 /*
@@ -107,43 +108,46 @@ SOLUTION WITH TWO ARRAYS
 */
 
 void solve2() {
+    FastReader in;
+    FastWriter out;
+
     int n1;
-    cin >> n1;
+    in >> n1;
     vector<int> arr1(n1);
-    for (int i = 0; i < n1; i++) cin >> arr1[i];
+    for (int i = 0; i < n1; i++) in >> arr1[i];
 
     SGTree sg1(n1);
     sg1.build(0, 0, n1 - 1, arr1);
 
     int n2;
-    cin >> n2;
+    in >> n2;
     vector<int> arr2(n2);
-    for (int i = 0; i < n2; i++) cin >> arr2[i];
+    for (int i = 0; i < n2; i++) in >> arr2[i];
 
     SGTree sg2(n2);
     sg2.build(0, 0, n2 - 1, arr2);
 
     int q;
-    cin >> q;
+    in >> q;
 
     while (q--) {
         int type;
-        cin >> type;
+        in >> type;
 
         // Query minimum in ranges
         if (type == 1) {
             int l1, r1, l2, r2;
-            cin >> l1 >> r1 >> l2 >> r2;
+            in >> l1 >> r1 >> l2 >> r2;
 
             int min1 = sg1.query(0, 0, n1 - 1, l1, r1);
             int min2 = sg2.query(0, 0, n2 - 1, l2, r2);
 
-            cout << min(min1, min2) << endl;
+            out << min(min1, min2) << '\n';
         }
         // Update value
         else {
             int arrNo, idx, val;
-            cin >> arrNo >> idx >> val;
+            in >> arrNo >> idx >> val;
 
             if (arrNo == 1) {
                 sg1.update(0, 0, n1 - 1, idx, val);
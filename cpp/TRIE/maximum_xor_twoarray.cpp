@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "../fast_io.h"
 using namespace std;
 
 // ⏱ Complexity
@@ -88,15 +89,18 @@ int maxXor(int n, int m, vector<int>& arr1, vector<int>& arr2) {
 
 // ------------------ DRIVER CODE ------------------
 int main() {
+    FastReader in;
+    FastWriter out;
+
     int n, m;
-    cin >> n >> m;
+    in >> n >> m;
 
     vector<int> arr1(n), arr2(m);
 
-    for (int i = 0; i < n; i++) cin >> arr1[i];
-    for (int i = 0; i < m; i++) cin >> arr2[i];
+    for (int i = 0; i < n; i++) in >> arr1[i];
+    for (int i = 0; i < m; i++) in >> arr2[i];
 
-    cout << maxXor(n, m, arr1, arr2) << endl;
+    out << maxXor(n, m, arr1, arr2) << '\n';
 
     return 0;
 }